@@ -0,0 +1,48 @@
+// Generated by tools/digraph_table.py — do not edit; re-run the script after changing the model
+// QWERTY touch-typist bigram model, normalised to English prose (x1.123)
+#pragma once
+
+#define DIGRAPH_OTHER 26        // class of every char that isn't a letter
+#define DIGRAPH_ONE 64          // scale 1.0
+
+const uint8_t DIGRAPH_CLASS[256] PROGMEM = {
+  26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+  26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+  26,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,26,26,26,26,
+  26,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,26,26,26,26,
+  26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+  26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+  26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+  26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+};
+
+// [prev][next], rows and columns a..z then other
+const uint8_t DIGRAPH_SCALE[27][27] PROGMEM = {
+  {  68, 72, 72, 68, 72, 68, 68, 59, 59, 59, 59, 50, 59, 50, 59, 59,115, 61, 57, 61, 59, 72, 72, 72, 59,115, 64 },
+  {  78, 68, 73, 78, 70,115,115, 59, 59, 59, 59, 59, 59, 59, 59, 59, 82,126, 78,126, 59,104, 82, 73, 59, 73, 64 },
+  {  78, 68, 68,115,107, 72, 72, 50, 59, 59, 59, 59, 59, 59, 50, 59, 82, 76, 78, 76, 59, 68, 82, 73, 59, 73, 64 },
+  {  73, 72,115, 68, 98, 68, 68, 59, 59, 59, 59, 59, 59, 59, 59, 59, 78, 72, 73, 72, 59, 72, 78, 78, 59, 78, 64 },
+  {  66, 76,126, 98, 68, 72, 72, 59, 59, 59, 59, 59, 59, 50, 59, 59, 73, 57, 66, 68, 59, 76, 73, 82, 59, 82, 64 },
+  {  73,115, 78, 73, 78, 68,104, 59, 59, 59, 59, 59, 59, 59, 59, 59, 78,115, 73,115, 59,115, 78, 78, 59, 78, 64 },
+  {  73,115, 78, 73, 78,104, 68, 59, 59, 59, 59, 59, 59, 59, 59, 59, 78,115, 73,115, 59,115, 78, 78, 59, 78, 64 },
+  {  50, 59, 59, 59, 50, 59, 59, 68, 66,104, 73, 73,115,115, 78, 78, 59, 59, 59, 59,115, 59, 59, 59,115, 59, 64 },
+  {  59, 59, 50, 59, 59, 59, 59, 72, 68, 72,115, 78, 76, 65, 62, 73, 59, 59, 50, 50, 68, 59, 59, 59, 68, 59, 64 },
+  {  59, 59, 59, 59, 59, 59, 59,104, 78, 68, 73, 73,115,115, 78, 78, 59, 59, 59, 59,115, 59, 59, 59,115, 59, 64 },
+  {  59, 59, 59, 59, 59, 59, 59, 68,115, 68, 68, 73, 72, 72, 78, 78, 59, 59, 59, 59, 72, 59, 59, 59, 72, 59, 64 },
+  {  59, 59, 59, 59, 50, 59, 59, 68, 61, 68, 68, 58, 72, 72,115, 78, 59, 59, 59, 59, 72, 59, 59, 59, 72, 59, 64 },
+  {  50, 59, 59, 59, 50, 59, 59,115, 82,115, 78, 78, 68,104, 82, 82, 59, 59, 59, 59,126, 59, 59, 59,126, 59, 64 },
+  {  59, 59, 59, 50, 50, 59, 50,115, 82,115, 78, 78,104, 68, 82, 82, 59, 59, 59, 50,126, 59, 59, 59,126, 59, 64 },
+  {  59, 59, 59, 59, 59, 50, 59, 72, 68, 72, 72,115, 65, 65, 68, 73, 59, 50, 59, 59, 57, 59, 59, 59, 68, 59, 64 },
+  {  59, 59, 59, 59, 59, 59, 59, 72, 68, 72, 72, 72, 76, 76, 68, 68, 59, 59, 59, 59, 68, 59, 59, 59, 68, 59, 64 },
+  { 115, 76, 76, 72, 68, 72, 72, 59, 59, 59, 59, 59, 59, 59, 59, 59, 68, 68, 72, 68, 59, 76, 68, 76, 59,126, 64 },
+  {  66,126, 82, 78, 62,115,115, 59, 50, 59, 59, 59, 59, 59, 50, 59, 73, 68, 78,104, 59,126, 73, 82, 59, 82, 64 },
+  {  73, 72, 72, 68, 61, 68, 68, 59, 50, 59, 59, 59, 59, 59, 59, 59, 78, 72, 68, 61, 59, 72,115,115, 59, 78, 64 },
+  {  78,126, 82, 78, 62,115,115, 50, 50, 59, 59, 59, 59, 59, 50, 59, 73,104, 78, 68, 59,126, 73, 82, 59, 82, 64 },
+  {  59, 59, 59, 59, 59, 59, 59,115, 73,115, 78, 78,126,126, 73, 73, 59, 50, 59, 59, 68, 59, 59, 59,104, 59, 64 },
+  {  78,104, 73, 78, 70,115,115, 59, 59, 59, 59, 59, 59, 59, 59, 59, 82,126, 78,126, 59, 68, 82, 73, 59, 73, 64 },
+  {  78, 76, 76, 72, 68, 72, 72, 59, 59, 59, 59, 59, 59, 59, 59, 59, 73, 68,115, 68, 59, 76, 68,126, 59, 82, 64 },
+  {  78, 68, 68, 72, 76, 72, 72, 59, 59, 59, 59, 59, 59, 59, 59, 59, 82, 76,115, 76, 59, 68,126, 68, 59, 73, 64 },
+  {  59, 59, 59, 59, 59, 59, 59,115, 73,115, 78, 78,126,126, 73, 73, 59, 59, 59, 59,104, 59, 59, 59, 68, 59, 64 },
+  { 115, 68, 68, 72, 76, 72, 72, 59, 59, 59, 59, 59, 59, 59, 59, 59,126, 76, 72, 76, 59, 68, 76, 68, 59, 68, 64 },
+  {  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64 },
+};
@@ -0,0 +1,959 @@
+/*
+  engine.h — the typing engine, independent of the board
+
+  Config (seqlocked EngineConfig), text ring, newline/code-mode transform, ASCII -> HID table, keystroke planner,
+  deadline scheduler and player. The platform supplies clock, waits, RNG seed and HID sink through EngineIo,
+  so the same code runs on the ESP32 (all three sketches, via engine_esp32.h) and natively under a simulated clock
+  (tools/host_sim.cpp). Which humanization layers a build has is a compile-time feature policy (FeaturesPro etc.).
+
+  Plain C++17 (stdint, math, <atomic>); include from exactly one translation unit, after sampler.h is available.
+*/
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <atomic>
+#include <algorithm>
+#include "sampler.h"
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#ifndef pgm_read_byte
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#endif
+#include "digraph.h"
+
+// ---------------- Config ----------------
+// All engine knobs live in one struct behind a seqlock. A writer makes cfgSeq odd, copies the new struct in and
+// makes it even again; readers copy the struct and retry if the sequence was odd or moved. Nobody takes a lock,
+// and the planner, which re-reads the config at every word boundary, never sees half of a change.
+struct EngineConfig {
+  int wpm = 100;
+  bool strict = false;
+  int jitterPct = 12;
+  int thinkChance = 0;
+  int mistakePct = 3;       // chance per-character to begin a mistake
+  bool typos = true;
+  bool longPauses = true;
+  int longPausePct = 5;
+  int longPauseMinMs = 600;
+  int longPauseMaxMs = 1200;
+  int newlineMode = 1;      // 0 keep,1 space,2 remove (per job: applied while the body uploads)
+  bool punctPause = true;
+  bool codeMode = false;    // OFF by default (per job)
+  int typoMaxChars = 1;     // maximum characters in a single mistake (1..6)
+  int maxErrors = 1;        // how many mistake chunks allowed concurrently (keeps small)
+  int holdMinMs = 18;       // simulated key hold min
+  int holdMaxMs = 100;      // simulated key hold max
+  bool logging = false;
+  bool turbo = false;       // high-throughput paste — no humanization, up to 6 keys per HID report (per job)
+  int layout = 0;           // host keyboard layout (LAYOUT_*)
+  bool digraphs = false;    // per-bigram latency model (digraph.h) on top of the log-normal IKI
+};
+EngineConfig cfgShared;
+std::atomic<uint32_t> cfgSeq(0);   // odd while a writer is copying into cfgShared
+
+static inline uint32_t cfgVersion(){ return cfgSeq.load(std::memory_order_acquire); }
+
+// Coherent copy, callable from any task on either core
+EngineConfig cfgSnapshot(){
+  EngineConfig c; uint32_t s0;
+  do {
+    s0 = cfgSeq.load(std::memory_order_acquire);
+    memcpy(&c, &cfgShared, sizeof(c));
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while((s0 & 1) || cfgSeq.load(std::memory_order_relaxed) != s0);
+  return c;
+}
+
+// Writers snapshot, edit their copy and publish it. The odd sequence also keeps a second writer out.
+void cfgPublish(const EngineConfig &c){
+  uint32_t s0 = cfgSeq.load(std::memory_order_relaxed);
+  while((s0 & 1) || !cfgSeq.compare_exchange_weak(s0, s0 + 1, std::memory_order_acquire)) s0 = cfgSeq.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  memcpy(&cfgShared, &c, sizeof(c));
+  cfgSeq.store(s0 + 2, std::memory_order_release);
+}
+
+// Runtime state
+volatile unsigned long typedChars = 0;
+
+// ---------------- Utilities ----------------
+int clampInt(int v,int a,int b){ if(v<a) return a; if(v>b) return b; return v; }
+static inline float ms_per_char_for_wpm(int wpm){ if(wpm<1) wpm=1; return 60000.0f / (wpm * 5.0f); }
+
+// Planner randomness (sampler.h): FastRng is seeded per job from EngineIo::seed() and lives in the Planner,
+// so a dry run with the same seed plans the same keys (ETA). The ziggurat tables are built once with ziggurat.init().
+NormalZiggurat ziggurat;
+// Same contract as Arduino random(lo, hi): lo..hi-1, lo when the range is empty
+static inline long planRandom(FastRng &r, long lo, long hi){ return r.range(lo, hi); }
+
+// Log-normal sample with mean_ms; sigma and exp(-sigma^2/2) are cached in the sampler for the session
+static inline float lognormal_sample_ms(FastRng &rng, const LogNormalSampler &iki, float mean_ms){
+  float val = iki.sample(rng, ziggurat, mean_ms);
+  if(val < 3.0f) val = 3.0f;
+  return val;
+}
+
+// Mean-IKI factor for typing next right after prev (1.0 for anything involving a non-letter): two flash reads
+static inline float digraphScale(char prev, char next){
+  uint8_t a = pgm_read_byte(&DIGRAPH_CLASS[(uint8_t)prev]), b = pgm_read_byte(&DIGRAPH_CLASS[(uint8_t)next]);
+  return pgm_read_byte(&DIGRAPH_SCALE[a][b]) * (1.0f / DIGRAPH_ONE);
+}
+
+// Small helper to cap jitter at very high WPM
+static inline float capJitterForWPM(int wpm, float jpct){ if(wpm >= 140 && jpct > 0.08f) return 0.08f; return jpct; }
+
+// ---------------- Text ring ----------------
+// A fixed ring of filtered text between the producer (the platform's upload path, or the host harness) and
+// the planner, which reads characters straight out of it and releases them once planned. Typing can start
+// while the text is still arriving and a paste of any size costs TEXT_RING_SIZE bytes.
+#define TEXT_RING_SIZE 16384       // power of two
+#define TEXT_PREROLL 512           // chars buffered before the first keystroke (or the whole body if smaller)
+struct TextRing {
+  uint8_t buf[TEXT_RING_SIZE];
+  std::atomic<uint32_t> wr;        // chars written so far (producer)
+  std::atomic<uint32_t> rd;        // chars released by the planner (consumer)
+  std::atomic<bool> eof;           // body complete, wr is final
+  uint32_t expected;               // upper bound of the final char count (raw body length)
+  bool code;                       // filter mode this job was started with
+  bool plan;                       // the body is a binary keystroke plan (planReplayStep), not text
+};
+TextRing textRing;
+
+static inline char textAt(uint32_t i){ return (char)textRing.buf[i & (TEXT_RING_SIZE - 1)]; }
+
+
+// ---------------- Text transform ----------------
+// One single-pass transform for both modes, run as an iterator over the caller's buffer (no copy, no heap):
+//   * CR, LF and CRLF become one newline (a CRLF split across upload chunks is still one newline)
+//   * newline mode: 0 keep as Enter, 1 replace with space, 2 remove — code mode always keeps newlines
+//   * code mode: ALL leading non-newline whitespace of every line is stripped
+struct TextTransform {
+  bool stripLeading;  // code mode
+  uint8_t nl;         // newline mode (0 keep, 1 space, 2 remove)
+  bool startOfLine;   // still inside a line's leading whitespace
+  bool lastCR;        // previous byte was CR (swallow a following LF)
+
+  void begin(bool code, uint8_t nlMode){ stripLeading = code; nl = code ? 0 : nlMode; startOfLine = true; lastCR = false; }
+
+  // Next output char from [in, end), advancing in. Returns false once the buffer is used up.
+  bool next(const uint8_t *&in, const uint8_t *end, char &out){
+    while(in < end){
+      char c = (char)*in++;
+      bool afterCR = lastCR; lastCR = false;
+      if(c == '\r' || c == '\n'){
+        if(c == '\n' && afterCR) continue; // LF of a CRLF
+        lastCR = (c == '\r');
+        startOfLine = true;
+        if(nl == 0){ out = '\n'; return true; }
+        if(nl == 1){ out = ' '; return true; }
+        continue; // mode 2 => drop entirely
+      }
+      // drop leading whitespace (space, tab, vertical-tab, form-feed, etc.)
+      if(stripLeading && startOfLine && isspace((unsigned char)c)) continue;
+      startOfLine = false;
+      out = c;
+      return true;
+    }
+    return false;
+  }
+};
+
+// ---------------- Resumable sources ----------------
+// A job played from stored bytes (the Pro sketch's documents) can be continued after a stop. The producer leaves a
+// mark (ring index, source offset, filter state) every SOURCE_MARK_SPACING chars it writes, enough to span the
+// text in flight; afterwards resumeAt() maps the job's typed count back to the first char that wasn't typed.
+// A resumed job starts on an empty ring, so the resume point has ring 0 and carries the chars still to drop.
+#define SOURCE_MARKS 32
+#define SOURCE_MARK_SPACING 1024
+static_assert(SOURCE_MARKS * SOURCE_MARK_SPACING >= 2 * TEXT_RING_SIZE, "marks must span the text in flight");
+struct SourcePos {
+  uint32_t ring, off, skip;  // ring index of the first char produced from source offset off, after dropping skip chars
+  bool startOfLine, lastCR;  // filter state at off
+};
+struct SourceMarks {
+  SourcePos m[SOURCE_MARKS];
+  uint8_t head, count;
+  void clear(){ head = count = 0; }
+  void push(const SourcePos &p){
+    m[(head + count) % SOURCE_MARKS] = p;
+    if(count < SOURCE_MARKS) count++; else head = (head + 1) % SOURCE_MARKS;
+  }
+  // Where the next job continues after this one typed `typed` chars; false if no mark reaches back that far
+  bool resumeAt(uint32_t typed, SourcePos &out) const {
+    for(int k = count - 1; k >= 0; k--){
+      const SourcePos &c = m[(head + k) % SOURCE_MARKS];
+      if(c.ring > typed) continue;
+      out = c; out.skip += typed - c.ring; out.ring = 0;
+      return true;
+    }
+    return false;
+  }
+};
+
+// Producer side: source bytes through xf into textRing, from a start position. put() never waits, so the caller
+// only hands it n bytes when textRing has room for n.
+struct SourceFeed {
+  TextTransform *xf;
+  SourcePos pos;           // next source byte; skip = chars still to drop (typed by the job this one resumes)
+  uint32_t lastMark;
+  // The job's first mark; textRing has just been reset for the job
+  SourcePos begin(TextTransform &t, const SourcePos &start){
+    xf = &t; pos = start; pos.ring = 0; lastMark = 0;
+    t.startOfLine = start.startOfLine; t.lastCR = start.lastCR;
+    return pos;
+  }
+  // n bytes from pos.off on; true when a new mark is due (returned in mark)
+  bool put(const uint8_t *in, uint32_t n, SourcePos &mark){
+    const uint8_t *end = in + n; char c;
+    while(pos.skip && xf->next(in, end, c)) pos.skip--;
+    uint32_t w = textRing.wr.load(std::memory_order_relaxed);
+    while(xf->next(in, end, c)) textRing.buf[w++ & (TEXT_RING_SIZE - 1)] = (uint8_t)c;
+    textRing.wr.store(w, std::memory_order_release);
+    pos.off += n;
+    if(w - lastMark < SOURCE_MARK_SPACING || pos.skip) return false;
+    mark = { w, pos.off, 0, xf->startOfLine, xf->lastCR };
+    lastMark = w;
+    return true;
+  }
+};
+
+// ---------------- HID output ----------------
+// Host keyboard layouts, built at compile time. A layout is described by what each physical key of the four
+// main rows types, unshifted and shifted (' ' = nothing ASCII); makeLayout() turns that into O(1) tables:
+//   * hid[ch]      ASCII -> HID usage | HID_SHIFT (0 = not typeable; 256 entries, so no range check)
+//   * chr[s][key]  usage -> char typed with shift s (keystroke log of a typo)
+//   * near[key]    physical neighbours (same row and the touching keys above and below) that type something
+// The US table is the one the Arduino Keyboard library uses. CR maps to 0 so CRLF types a single Enter.
+#define HID_SHIFT 0x80
+#define HID_MOD_LSHIFT 0x02
+#define HID_KEY_BACKSPACE 0x2a
+#define TURBO_REPORT_US 8000       // pacing per report in turbo mode (about one short connection interval)
+
+// Physical rows (HID usages of an ISO board; ANSI lacks 0x32 and 0x64) and each row's left edge in quarter keys
+static constexpr uint8_t KEY_ROWS[4][13] = {
+  { 0x35,0x1e,0x1f,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x2d,0x2e },  // `1234567890-=
+  { 0x14,0x1a,0x08,0x15,0x17,0x1c,0x18,0x0c,0x12,0x13,0x2f,0x30,0x31 },  // qwertyuiop[]\ .
+  { 0x04,0x16,0x07,0x09,0x0a,0x0b,0x0d,0x0e,0x0f,0x33,0x34,0x32 },       // asdfghjkl;'#
+  { 0x64,0x1d,0x1b,0x06,0x19,0x05,0x11,0x10,0x36,0x37,0x38 },            // \zxcvbnm,./
+};
+static constexpr uint8_t KEY_ROW_LEN[4] = { 13, 13, 12, 11 };
+static constexpr uint8_t KEY_ROW_X[4] = { 0, 6, 7, 5 };
+
+struct KeyNeighbours { uint8_t n; uint8_t key[6]; };
+struct KeyLayout {
+  uint8_t hid[256];
+  char chr[2][128];
+  KeyNeighbours near[128];
+};
+struct LayoutRows { const char *lo[4]; const char *hi[4]; };
+
+static constexpr KeyLayout makeLayout(const LayoutRows &rows){
+  KeyLayout L{};
+  const uint8_t fixed[][2] = { { '\b', 0x2a }, { '\t', 0x2b }, { '\n', 0x28 }, { 27, 0x29 }, { ' ', 0x2c } };
+  for(const auto &f : fixed){ L.hid[f[0]] = f[1]; L.chr[0][f[1]] = L.chr[1][f[1]] = (char)f[0]; }
+  for(int r=0;r<4;r++) for(int c=0;c<KEY_ROW_LEN[r];c++){
+    uint8_t key = KEY_ROWS[r][c];
+    char lo = rows.lo[r][c], hi = rows.hi[r][c];
+    if(lo != ' '){ L.chr[0][key] = lo; if(!L.hid[(uint8_t)lo]) L.hid[(uint8_t)lo] = key; }
+    if(hi != ' '){ L.chr[1][key] = hi; if(!L.hid[(uint8_t)hi]) L.hid[(uint8_t)hi] = key | HID_SHIFT; }
+  }
+  for(int r=0;r<4;r++) for(int c=0;c<KEY_ROW_LEN[r];c++){
+    KeyNeighbours &nb = L.near[KEY_ROWS[r][c]];
+    int x = KEY_ROW_X[r] + 4 * c;
+    for(int r2=r-1;r2<=r+1;r2++){
+      if(r2 < 0 || r2 > 3) continue;
+      for(int c2=0;c2<KEY_ROW_LEN[r2];c2++){
+        int dx = KEY_ROW_X[r2] + 4 * c2 - x;
+        if(r2 == r ? (dx != 4 && dx != -4) : (dx >= 4 || dx <= -4)) continue;
+        if(rows.lo[r2][c2] != ' ') nb.key[nb.n++] = KEY_ROWS[r2][c2];
+      }
+    }
+  }
+  return L;
+}
+
+enum { LAYOUT_US, LAYOUT_UK, LAYOUT_DVORAK, LAYOUT_COUNT };
+static constexpr KeyLayout LAYOUTS[LAYOUT_COUNT] = {
+  makeLayout({ { "`1234567890-=", "qwertyuiop[]\\", "asdfghjkl;' ", " zxcvbnm,./" },
+               { "~!@#$%^&*()_+", "QWERTYUIOP{}|", "ASDFGHJKL:\" ", " ZXCVBNM<>?" } }),
+  makeLayout({ { "`1234567890-=", "qwertyuiop[] ", "asdfghjkl;'#", "\\zxcvbnm,./" },             // UK (£ and ¬ aren't ASCII)
+               { " !\" $%^&*()_+", "QWERTYUIOP{} ", "ASDFGHJKL:@~", "|ZXCVBNM<>?" } }),
+  makeLayout({ { "`1234567890[]", "',.pyfgcrl/=\\", "aoeuidhtns- ", " ;qjkxbmwvz" },              // US Dvorak
+               { "~!@#$%^&*(){}", "\"<>PYFGCRL?+|", "AOEUIDHTNS_ ", " :QJKXBMWVZ" } }),
+};
+static const char *const LAYOUT_NAMES[LAYOUT_COUNT] = { "us", "uk", "dvorak" };
+
+static inline void hidLookup(const KeyLayout &L, char ch, uint8_t &key, uint8_t &mod){
+  uint8_t h = L.hid[(uint8_t)ch];
+  key = h & 0x7f; mod = (h >> 7) * HID_MOD_LSHIFT;
+}
+
+// One keyboard input report as the engine emits it (the platform maps it onto its HID stack)
+struct HidReport {
+  uint8_t mod;
+  uint8_t keys[6];
+};
+
+// Keystroke log entry types (EngineIo::logKey)
+#define LOG_KEY 1          // correct character
+#define LOG_TYPO 2         // mistaken character
+#define LOG_BACKSPACE 3    // correction
+
+// ---------------- Platform interface ----------------
+// Everything the engine needs from the outside world. The sketch implements it with esp_timer, FreeRTOS
+// notifications and BleKeyboard; the host harness with a simulated clock and a recording sink. Calls come from
+// the thread running typeLikeHuman() only.
+struct EngineIo {
+  virtual int64_t nowUs() = 0;                 // monotonic µs
+  virtual void sleepUntil(int64_t absUs) = 0;  // return at absUs, or earlier when woken (stop, pause, new text)
+  virtual bool running() = 0;                  // false once the job was stopped
+  virtual bool paused() = 0;
+  virtual void waitResume() = 0;               // block while paused; returns on resume or stop
+  virtual void waitText() = 0;                 // short wait for the producer to add text to textRing
+  virtual uint32_t seed() = 0;                 // per-job RNG seed
+  virtual bool hidReady() = 0;                 // a host is listening
+  virtual void hidSend(const HidReport &r) = 0;
+  virtual bool waitHid(uint32_t ms){ (void)ms; return false; } // host lost mid-job: wait up to ms for it (false: give up)
+  virtual void turbo(bool on){ (void)on; }     // entering/leaving a turbo job (e.g. BLE connection interval)
+  virtual void logKey(uint8_t type, char ch, int64_t tUs, uint32_t ikiUs, uint32_t holdUs){ (void)type; (void)ch; (void)tUs; (void)ikiUs; (void)holdUs; }
+  virtual ~EngineIo(){}
+};
+EngineIo *engineIo = NULL;  // set by the platform before the first job
+
+#define HID_RESUME_WINDOW_MS 30000   // how long a job waits for a dropped HID host before giving up
+volatile bool hidWaiting = false;    // the player is waiting for the host to come back
+
+static inline void hidAllUp(){ HidReport r = {}; engineIo->hidSend(r); }
+
+// ---------------- Metrics ----------------
+// Always-on health counters (/metrics), cheap enough for the player's hot path: relaxed 32-bit atomics with a
+// single writer, readable from any core. Histograms keep one count per range; the exporter makes them
+// cumulative. Counters wrap at 2^32 like any Prometheus counter source. /bench rows are not counted.
+#define METRIC_IKI_BUCKETS 10
+#define METRIC_LATE_BUCKETS 8
+static const uint32_t METRIC_IKI_LE_US[METRIC_IKI_BUCKETS] = { 25000, 50000, 75000, 100000, 150000, 200000, 300000, 500000, 1000000, 2000000 };
+static const uint32_t METRIC_LATE_LE_US[METRIC_LATE_BUCKETS] = { 25, 50, 100, 250, 500, 1000, 5000, 25000 };
+struct EngineMetrics {
+  std::atomic<uint32_t> iki[METRIC_IKI_BUCKETS + 1], ikiCount, ikiSumMs;      // key-down to key-down
+  std::atomic<uint32_t> late[METRIC_LATE_BUCKETS + 1], lateCount, lateSumUs;  // key-down behind its deadline
+  std::atomic<uint32_t> workUs;      // player time outside deadline waits (planning top-ups, HID sends)
+  std::atomic<uint32_t> jobs, chars, typos, backspaces;
+  std::atomic<uint32_t> stalls;      // re-anchors after falling SCHED_MAX_LAG_US behind
+  std::atomic<uint32_t> hidLost;     // jobs cut short because the HID host went away
+  std::atomic<uint32_t> hidResumes;  // jobs that carried on after the host came back
+};
+EngineMetrics metrics;
+
+static inline void metricAdd(std::atomic<uint32_t> &c, uint32_t v = 1){ c.store(c.load(std::memory_order_relaxed) + v, std::memory_order_relaxed); }
+static inline void metricObserve(std::atomic<uint32_t> *b, const uint32_t *le, int n, uint32_t v){
+  int k = 0;
+  while(k < n && v > le[k]) k++;
+  metricAdd(b[k]);
+}
+
+// ---------------- Deadline scheduler ----------------
+// Every key transition is due at an absolute deadline on the engine clock (µs): job start + planned offset.
+// Time spent inside HID sends or planning therefore never accumulates as drift.
+#define SCHED_MAX_LAG_US 250000    // if we fall further behind than this (BLE stall), re-anchor instead of bursting
+
+struct KeySchedule {
+  int64_t startUs;   // job start, shifted forward by time spent paused (and by re-anchoring)
+  int64_t originUs;  // job start, never shifted
+  int64_t heldUs;    // time spent paused or waiting for upload text: not part of the job's active time
+  int64_t rebasedUs; // moved from the plan's 32-bit offsets into startUs (planRebase)
+};
+KeySchedule sched;
+volatile uint32_t jobEndMs = 0;   // engine-clock ms at which the current plan finishes (approximate, for /status ETA)
+volatile uint32_t jobChars = 0;   // expected length of the current job, 0 if unknown (chunked upload)
+int64_t planTotalUs = 0;          // planned duration of the whole job (from the current time base)
+
+static inline void schedShift(int64_t us){ sched.startUs += us; jobEndMs = (uint32_t)((sched.startUs + planTotalUs) / 1000); }
+// Shift for time the job was held on purpose (pause, upload starvation); re-anchoring after a stall is not held time
+static inline void schedHold(int64_t us){ sched.heldUs += us; schedShift(us); }
+static inline void schedBegin(){ sched.startUs = sched.originUs = engineIo->nowUs(); sched.heldUs = sched.rebasedUs = 0; schedShift(0); }
+// µs since the job started, minus held time — what the WPM target is measured against
+static inline int64_t schedActiveUs(){ return engineIo->nowUs() - sched.originUs - sched.heldUs; }
+
+// Pause point: block while paused and push the whole schedule back by the time spent paused
+static void schedHoldWhilePaused(){
+  if(!engineIo->paused()) return;
+  int64_t p0 = engineIo->nowUs();
+  engineIo->waitResume();
+  schedHold(engineIo->nowUs() - p0);
+}
+
+// Sleep until the planned offset offUs. Returns false if the job was stopped.
+static bool schedWaitUntil(uint32_t offUs){
+  for(;;){
+    if(!engineIo->running()) return false;
+    if(engineIo->paused()){ schedHoldWhilePaused(); continue; }
+    int64_t due = sched.startUs + offUs;
+    int64_t left = due - engineIo->nowUs();
+    if(left < -SCHED_MAX_LAG_US){ schedShift(-left); metricAdd(metrics.stalls); return true; }
+    if(left <= 0) return true;
+    engineIo->sleepUntil(due);
+  }
+}
+
+// ---------------- Throughput feedback ----------------
+// The player timestamps each report that completes source chars right after sendReport() returns, on the job's
+// active clock (schedActiveUs). lagUs — how far real sends trail their planned offsets — closes the planner's
+// PI loop, so time lost to BLE back-pressure or re-anchoring after a stall is made up instead of silently
+// lowering the WPM. The same timestamps give the measured WPM exported by /status and /events.
+#define PI_HORIZON 100   // chars the proportional term spreads the current error over (fewer near the end)
+#define PI_TI 400        // integral time constant, chars
+struct RateMeter {
+  uint32_t chars;           // source chars whose report has been sent
+  int64_t firstUs, lastUs;  // active time of the first and the latest of those sends
+  int32_t lagUs;            // latest send completion minus its planned offset
+};
+RateMeter rate;
+volatile uint16_t measuredWpm = 0; // over the current (or last) job, from send-completion timestamps
+
+static inline void rateBegin(){ rate = {}; measuredWpm = 0; }
+
+static inline void rateSent(uint8_t done, uint32_t plannedUs){
+  int64_t t = schedActiveUs();
+  if(rate.chars == 0) rate.firstUs = t;
+  rate.chars += done; rate.lastUs = t;
+  rate.lagUs = (int32_t)(t - (int64_t)plannedUs - sched.rebasedUs);
+  if(rate.chars > 1 && t > rate.firstUs) measuredWpm = (uint16_t)((uint64_t)(rate.chars - 1) * 12000000ULL / (uint64_t)(t - rate.firstUs));
+}
+
+// Bench probe, filled by the player only while a /bench row runs
+#define BENCH_BUCKET_US 4
+#define BENCH_BUCKETS 256          // scheduling error histogram covers 0..1 ms; later keys only count in over/max
+#define BENCH_STALL_US 1000        // a key-down this late counts as a stall
+struct BenchProbe {
+  bool on;
+  uint16_t hist[BENCH_BUCKETS];
+  uint32_t n, over, errMax, stalls;
+  uint64_t costSum;                // player work per report (everything but the deadline waits)
+  uint32_t costMax;
+};
+BenchProbe probe;
+
+static inline void probeKey(int64_t errUs, uint32_t costUs){
+  uint32_t e = errUs > 0 ? (uint32_t)errUs : 0;
+  if(e / BENCH_BUCKET_US < BENCH_BUCKETS) probe.hist[e / BENCH_BUCKET_US]++; else probe.over++;
+  if(e > probe.errMax) probe.errMax = e;
+  if(e >= BENCH_STALL_US) probe.stalls++;
+  probe.n++;
+  probe.costSum += costUs;
+  if(costUs > probe.costMax) probe.costMax = costUs;
+}
+
+// Upper edge of the bucket holding the q-th quantile (errMax when it lies past the histogram)
+static inline uint32_t probePercentile(float q){
+  uint32_t want = (uint32_t)ceilf(q * probe.n), acc = 0;
+  for(int b=0;b<BENCH_BUCKETS;b++){ acc += probe.hist[b]; if(acc >= want && acc) return (uint32_t)(b + 1) * BENCH_BUCKET_US; }
+  return probe.errMax;
+}
+
+// ---------------- Feature policies ----------------
+// The planner and player are templates over one of these. A feature a build leaves out is a constant false, so
+// its branches, config reads and RNG draws are compiled out rather than skipped; EngineConfig switches only
+// matter for features the build has. typeLikeHuman() without a policy is the full pro build.
+struct FeaturesPro {
+  static constexpr bool human = true;     // log-normal IKI, jitter, session WPM variation, digraphs, spacing pauses
+  static constexpr bool typos = true;     // neighbour-key mistakes corrected with Backspace
+  static constexpr bool pauses = true;    // long pauses before spaces and thinking pauses
+  static constexpr bool holds = true;     // random key-hold times (fixed HOLD_FIXED_MS otherwise)
+  static constexpr bool logging = true;   // keystroke log through EngineIo::logKey
+  static constexpr bool codeMode = true;  // code-mode Enter: no typos or pauses around it
+  static constexpr bool turbo = true;     // chorded high-throughput paste
+  static constexpr bool replay = true;    // uploaded keystroke plans (/type?plan=1)
+  static constexpr bool flat = false;     // the original sketches' timing (below) instead of the log-normal model
+};
+// esp32.ino and 15-11-2025.ino: the original humanization, without hold simulation, log, turbo or plans, and their
+// original timing model: flat jitter around the paced interval (6 ms floor, no digraphs), no per-session speed
+// multiplier, single-char typos corrected after a 110-380 ms pause
+struct FeaturesClassic {
+  static constexpr bool human = true, typos = true, pauses = true, holds = false;
+  static constexpr bool logging = false, codeMode = true, turbo = false, replay = false, flat = true;
+};
+// Strict WPM only: every key on the configured pace, nothing random
+struct FeaturesStrict {
+  static constexpr bool human = false, typos = false, pauses = false, holds = false;
+  static constexpr bool logging = false, codeMode = false, turbo = false, replay = false, flat = false;
+};
+#define HOLD_FIXED_MS 30           // key hold when the build has no hold simulation
+
+// ---------------- Keystroke plan ----------------
+// The planner compiles the preprocessed text into fixed-size KeyEvents: every random decision (log-normal
+// delay, jitter, long pause, typo, hold) is taken here. The player then only streams events to the HID
+// layer at their deadlines. The plan lives in a ring that the player tops up whenever the next deadline
+// leaves slack, so planning never delays a keystroke and RAM use doesn't depend on the text length.
+#define EV_CHAR_DONE 0x01          // this event completes one source character (advances typedChars)
+#define EV_TYPO 0x02               // mistaken character (logged as LOG_TYPO)
+// Events with the same downUs form one HID report (turbo chords: distinct keys, same modifier, at most 6).
+struct __attribute__((packed)) KeyEvent {
+  uint32_t downUs;   // key-down offset from job start
+  uint32_t upUs;     // key-up offset from job start
+  uint8_t key;       // HID usage (0 = nothing to send)
+  uint8_t mod;       // HID modifier bits
+  uint8_t flags;     // EV_*
+  char ch;           // source character (for the keystroke log)
+};
+
+#define PLAN_CAP 256               // ring capacity (events)
+#define PLAN_STEP_MAX (3 * 6 + 2)  // most events one planStep() can add (6-char typo: wrong + backspace + retype)
+#define PLAN_GUARD_US 400          // stop topping up when the next deadline is closer than this
+#define PLAN_AHEAD_US 1500000      // and when the plan reaches this far past the key being played (bounds config latency)
+#define PLAN_REBASE_US 0x80000000u // offsets are 32-bit µs (71 min): past this the time base is moved forward
+#define KEY_GAP_US 2000            // a key is released at least this long before the next goes down
+
+struct KeyPlan {
+  KeyEvent ev[PLAN_CAP];
+  uint16_t head, count;
+};
+KeyPlan plan;
+
+struct Planner {
+  uint32_t i, N;           // next char to plan; expected total (exact once the upload is complete)
+  uint32_t tUs;            // planned time of the next key-down
+  uint32_t playUs;         // downUs of the key the player is on
+  const KeyLayout *layout; // host keyboard layout (cfg.layout)
+  FastRng rng;
+  LogNormalSampler iki;    // IKI spread, fixed for the session
+  EngineConfig cfg;        // snapshot, refreshed at word boundaries while emitting
+  uint32_t cfgSeen;        // cfgSeq the snapshot was taken at
+  float speedMul; int wpmOffset; // per-session humanization of the configured WPM (not in strict mode)
+  float baseMs, jitterPct;
+  bool strict, code, emit; // emit=false: dry run (ETA), nothing stored or logged
+  bool turbo;
+  bool cfgLive;            // follow /config changes (off for a bench run's fixed config)
+  bool done;               // every char of a finished upload has been planned
+  bool wordStart;          // next char starts a word
+  bool replay;             // playing an uploaded keystroke plan: i counts bytes, nothing is sampled
+  uint8_t need;            // bytes past i the next planStep() needs (a plan event split across upload chunks)
+  int mistakesCurrently;   // typos since the last clean char (cfg.maxErrors caps the streak)
+  float integ;             // PI drift control: accumulated error (ms x chars)
+  uint32_t refI; float refMs; // PI reference point: char refI is ideally due at refMs, then one per baseMs
+  uint8_t gCount, gMod, gKeys[6]; // turbo: chord being filled
+};
+
+// Derive the pacing of the plan from p.cfg
+template<class F> static void planApplyConfig(Planner &p){
+  p.strict = !F::human || p.cfg.strict;
+  int wpm = p.strict ? clampInt(p.cfg.wpm, 10, 300) : clampInt(p.cfg.wpm + p.wpmOffset, 10, 300);
+  p.baseMs = ms_per_char_for_wpm(wpm) * (p.strict ? 1.0f : p.speedMul);
+  p.jitterPct = capJitterForWPM(wpm, clampInt(p.cfg.jitterPct,5,45) / 100.0f);
+  p.layout = &LAYOUTS[clampInt(p.cfg.layout, 0, LAYOUT_COUNT - 1)];
+}
+
+// Move the planner's time base forward by us, so a long job never wraps its 32-bit offsets. The PI reference is
+// re-expressed at the current char, which also keeps its float arithmetic small.
+static void planRebase(Planner &p, uint32_t us){
+  p.refMs += float(p.i - p.refI) * p.baseMs - us / 1000.0f; p.refI = p.i;
+  p.tUs -= us; p.playUs = p.playUs > us ? p.playUs - us : 0;
+}
+
+// Word boundary: take a /config or /livewpm change made mid-job
+template<class F> static void planReloadConfig(Planner &p){
+  p.cfgSeen = cfgVersion(); // read before the snapshot: a write in between just triggers one more reload
+  p.cfg = cfgSnapshot();
+  float oldBase = p.baseMs;
+  planApplyConfig<F>(p);
+  if(p.baseMs == oldBase) return;
+  // new pace: drift control restarts from where the job is now, the ETA of the rest is rescaled
+  p.refI = p.i; p.refMs = p.tUs / 1000.0f + rate.lagUs / 1000.0f; p.integ = 0;
+  if(planTotalUs > p.tUs) planTotalUs = p.tUs + (int64_t)((planTotalUs - p.tUs) * (p.baseMs / oldBase));
+  schedShift(0);
+}
+
+static inline void planPushEv(Planner &p, uint8_t key, uint8_t mod, char ch, float holdMs, float afterMs, uint8_t flags){
+  uint32_t after = (uint32_t)(afterMs * 1000.0f);
+  if(p.emit){
+    KeyEvent &e = plan.ev[(plan.head + plan.count) % PLAN_CAP];
+    uint32_t hold = (uint32_t)(holdMs * 1000.0f);
+    uint32_t maxHold = (after > 2 * KEY_GAP_US) ? after - KEY_GAP_US : after / 2;
+    if(hold == 0 || hold > maxHold) hold = maxHold;
+    e.downUs = p.tUs; e.upUs = p.tUs + hold;
+    e.key = key; e.mod = mod; e.flags = flags; e.ch = ch;
+    plan.count++;
+  }
+  p.tUs += after;
+}
+static inline void planPush(Planner &p, char ch, float holdMs, float afterMs, uint8_t flags){
+  uint8_t key, mod; hidLookup(*p.layout, ch, key, mod);
+  planPushEv(p, key, mod, ch, holdMs, afterMs, flags);
+}
+static inline void planPushKey(Planner &p, uint8_t hidKey, float afterMs){
+  if(p.emit){
+    KeyEvent &e = plan.ev[(plan.head + plan.count) % PLAN_CAP];
+    uint32_t after = (uint32_t)(afterMs * 1000.0f);
+    e.downUs = p.tUs; e.upUs = p.tUs + after / 2; e.key = hidKey; e.mod = 0; e.flags = 0; e.ch = '\b';
+    plan.count++;
+  }
+  p.tUs += (uint32_t)(afterMs * 1000.0f);
+}
+
+// Turbo: add a character to the current chord; a modifier change, a repeated key or a full report starts the next
+// chord one down+up report pair later. Hosts register the keys of one report in array order.
+static void planTurboChar(Planner &p, char c){
+  uint8_t key, mod; hidLookup(*p.layout, c, key, mod);
+  if(key && p.gCount){
+    bool dup = false;
+    for(uint8_t k=0;k<p.gCount;k++) if(p.gKeys[k] == key) dup = true;
+    if(dup || p.gCount == 6 || mod != p.gMod){ p.tUs += 2 * TURBO_REPORT_US; p.gCount = 0; }
+  }
+  if(key){ if(p.gCount == 0) p.gMod = mod; p.gKeys[p.gCount++] = key; }
+  if(p.emit){
+    KeyEvent &e = plan.ev[(plan.head + plan.count) % PLAN_CAP];
+    e.downUs = p.tUs; e.upUs = p.tUs + TURBO_REPORT_US;
+    e.key = key; e.mod = p.gMod; e.flags = EV_CHAR_DONE; e.ch = c;
+    plan.count++;
+  }
+}
+
+// Typo: a physical neighbour of the key that types correctChar, with the same shift state. Keys without
+// neighbours (space, Enter) borrow the ones of fallback, the alphanumeric that started the mistake.
+static inline void planPushTypo(Planner &p, char correctChar, char fallback, float holdMs){
+  const KeyLayout &L = *p.layout;
+  uint8_t h = L.hid[(uint8_t)correctChar];
+  if(!L.near[h & 0x7f].n) h = L.hid[(uint8_t)fallback];
+  const KeyNeighbours &nb = L.near[h & 0x7f];
+  uint8_t key = nb.key[planRandom(p.rng, 0, nb.n)], shift = h >> 7;
+  planPushEv(p, key, shift * HID_MOD_LSHIFT, L.chr[shift][key], holdMs, holdMs, EV_TYPO);
+}
+
+// ---------------- Uploaded keystroke plans ----------------
+// A client or host tool can compute the whole timed schedule itself and POST it (/type?plan=1); the device then
+// only replays it, and typeLikeHuman's sampling stays the on-device fallback. LEB128 varints throughout:
+//   header  'K' 'P' PLAN_VERSION, varint chars (source chars the plan types), varint duration ms (ETA)
+//   event   tag (PLAN_F_*), HID usage (0 = none, just time), [modifier byte if PLAN_F_MOD],
+//           varint key-down delta from the previous event's key-down, varint hold — both in PLAN_TICK_US
+// An event is 4–6 bytes at typing speeds. Events with a zero delta share one HID report (up to 6 keys, the
+// modifier of the last one), as turbo chords do. The hold must end before the next key-down.
+#define PLAN_VERSION 1
+#define PLAN_TICK_US 50
+#define PLAN_F_DONE 0x01   // completes a source char (progress, measured WPM)
+#define PLAN_F_TYPO 0x02   // mistaken key (metrics, keystroke log)
+#define PLAN_F_MOD  0x04   // a modifier byte follows the usage
+static_assert(PLAN_F_DONE == EV_CHAR_DONE && PLAN_F_TYPO == EV_TYPO, "plan tags carry the event flags as they are");
+
+// Varint at ring index j (advanced past it): 1 ok, 0 runs past end (not uploaded yet), -1 longer than 32 bits
+static int ringVarint(uint32_t &j, uint32_t end, uint32_t &v){
+  v = 0;
+  for(int s=0;s<35;s+=7){
+    if(j >= end) return 0;
+    uint8_t b = (uint8_t)textAt(j++);
+    v |= (uint32_t)(b & 0x7f) << s;
+    if(!(b & 0x80)) return 1;
+  }
+  return -1;
+}
+
+// Header at the start of the ring (the preroll holds all of it): sets the job's char count and ETA
+static bool planReplayHeader(Planner &p){
+  uint32_t avail = textRing.wr.load(std::memory_order_acquire), j = 3, chars, ms;
+  if(avail < 3 || textAt(0) != 'K' || textAt(1) != 'P' || (uint8_t)textAt(2) != PLAN_VERSION) return false;
+  if(ringVarint(j, avail, chars) <= 0 || ringVarint(j, avail, ms) <= 0) return false;
+  jobChars = chars; planTotalUs = (int64_t)ms * 1000;
+  p.i = j;
+  return true;
+}
+
+// One plan event into the ring. A truncated or malformed plan ends the job at that point.
+static bool planReplayStep(Planner &p, uint32_t avail, bool eof){
+  uint32_t j = p.i, d = 0, h = 0;
+  uint8_t tag = 0, key = 0, mod = 0;
+  int ok = (avail - j >= 2) ? 1 : 0;
+  if(ok){
+    tag = (uint8_t)textAt(j++); key = (uint8_t)textAt(j++);
+    if(tag & PLAN_F_MOD){ if(j < avail) mod = (uint8_t)textAt(j++); else ok = 0; }
+  }
+  if(ok > 0) ok = ringVarint(j, avail, d);
+  if(ok > 0) ok = ringVarint(j, avail, h);
+  if(ok <= 0){
+    if(ok < 0 || eof){ p.done = true; p.i = avail; }
+    else p.need = (uint8_t)(avail - p.i + 1);
+    return false;
+  }
+  p.need = 1;
+  p.tUs += d * PLAN_TICK_US;
+  if(p.emit){
+    KeyEvent &e = plan.ev[(plan.head + plan.count) % PLAN_CAP];
+    e.downUs = p.tUs; e.upUs = p.tUs + h * PLAN_TICK_US;
+    e.key = key; e.mod = mod; e.flags = tag & (PLAN_F_DONE | PLAN_F_TYPO);
+    e.ch = key < 128 ? p.layout->chr[(mod & 0x22) ? 1 : 0][key] : 0; // either shift
+    plan.count++;
+  }
+  p.i = j;
+  return true;
+}
+
+// Plan one source character (or one whole typo chunk). Returns false when the buffered text is exhausted
+// (p.done tells whether the upload is finished too).
+template<class F> static bool planStep(Planner &p){
+  bool eof = textRing.eof.load(std::memory_order_acquire);  // read before wr: once eof is seen wr is final
+  uint32_t avail = textRing.wr.load(std::memory_order_acquire);
+  if(p.i >= avail){ p.done = eof; return false; }
+  p.N = eof ? avail : std::max(textRing.expected, avail);
+  uint32_t N = p.N, i = p.i;
+  if(F::replay && p.replay) return planReplayStep(p, avail, eof);
+  if(F::turbo && p.turbo){ planTurboChar(p, textAt(i)); p.i = i + 1; return true; }
+  const float MIN_DELAY = F::flat ? 6.0f : 3.0f; const float CORR_LIMIT = 0.5f;
+  char c = textAt(i);
+  if(p.emit && p.cfgLive && p.wordStart && cfgVersion() != p.cfgSeen) planReloadConfig<F>(p);
+  p.wordStart = (c == ' ' || c == '\n');
+  const EngineConfig &cfg = p.cfg;
+  float baseMs = p.baseMs; bool strict = !F::human || p.strict;
+
+  // PI drift control: error = when this char will actually go out (planned time plus the lag measured on real
+  // sends; a dry run assumes none) minus its ideal time i*baseMs
+  float elapsed = p.tUs / 1000.0f + (p.emit ? rate.lagUs / 1000.0f : 0.0f);
+  size_t remaining = (N - i); if(remaining==0) remaining = 1;
+  float idealElapsed = p.refMs + float(i - p.refI) * baseMs;
+  float error = elapsed - idealElapsed;
+  float horizon = (float)std::min(remaining, (size_t)PI_HORIZON);
+  float correction = -(error + p.integ / PI_TI) / horizon;
+  if(correction > baseMs*CORR_LIMIT) correction = baseMs*CORR_LIMIT;
+  else if(correction < -baseMs*CORR_LIMIT) correction = -baseMs*CORR_LIMIT;
+  else p.integ += error; // integrate only while unsaturated (no wind-up)
+
+  // log-normal sampling for humanlike spikes
+  // nextDelay is the gap to the following key; the digraph model scales its mean by the bigram (a following
+  // char that hasn't arrived yet counts as a non-letter). Drift control still holds the average WPM.
+  float mean = baseMs + correction;
+  float nextDelay = mean;
+  if(F::human && F::flat){
+    nextDelay = mean * (1.0f + ((planRandom(p.rng, -1000,1001)/1000.0f) * p.jitterPct));
+  } else if(F::human){
+    if(cfg.digraphs) mean += baseMs * (digraphScale(c, i + 1 < avail ? textAt(i + 1) : ' ') - 1.0f);
+    nextDelay = lognormal_sample_ms(p.rng, p.iki, mean);
+    if(nextDelay < MIN_DELAY) nextDelay = MIN_DELAY;
+    // apply jitter as multiplicative noise
+    float jitterFactor = 1.0f + ((planRandom(p.rng, -1000,1001)/1000.0f) * p.jitterPct);
+    nextDelay *= jitterFactor;
+  }
+  if(nextDelay < MIN_DELAY) nextDelay = MIN_DELAY;
+
+  // code mode newline (we normalized CRLF -> '\n'): plain Enter, no typos or pauses
+  if(F::codeMode && p.code && c == '\n'){
+    planPush(p, '\n', 0, nextDelay, EV_CHAR_DONE);
+    p.i = i + 1;
+    return true;
+  }
+
+  bool isSpace = (c==' ');
+  bool isPunct = (c=='.'||c==','||c=='!'||c=='?'||c==';'||c==':');
+
+  // long pause before the space
+  if(F::pauses && !strict && cfg.longPauses && isSpace && (planRandom(p.rng, 0,100) < cfg.longPausePct)){
+    p.tUs += (uint32_t)planRandom(p.rng, cfg.longPauseMinMs, cfg.longPauseMaxMs+1) * 1000u;
+  }
+
+  bool alnum = ((c>='a'&&c<='z')||(c>='A'&&c<='Z')||(c>='0'&&c<='9'));
+  bool beginTypo = F::typos && (!strict) && cfg.typos && (planRandom(p.rng, 0,100) < cfg.mistakePct) && alnum && (p.mistakesCurrently < cfg.maxErrors);
+  if(beginTypo && F::flat){
+    // one wrong key, Backspace after max(60 ms, the interval), the right key after a 110-380 ms pause
+    planPushTypo(p, c, c, HOLD_FIXED_MS);
+    p.tUs += (uint32_t)((std::max(60.0f, nextDelay) - HOLD_FIXED_MS) * 1000.0f);
+    planPushKey(p, HID_KEY_BACKSPACE, planRandom(p.rng, 110,380));
+    planPush(p, c, HOLD_FIXED_MS, clampInt((int)(nextDelay*0.5f) + planRandom(p.rng, 20,120), 20, 800), EV_CHAR_DONE);
+    p.i = i + 1;
+    p.mistakesCurrently++;
+  } else if(beginTypo){
+    // decide how many chars to include in this mistake (1..typoMaxChars)
+    int len = clampInt(1 + planRandom(p.rng, 0, cfg.typoMaxChars-1), 1, cfg.typoMaxChars);
+    // ensure we don't exceed buffer (only chars that have already arrived can be retyped)
+    if((int)(avail - i) < len) len = (int)(avail - i);
+    // wrong chunk, each key held for a random hold
+    for(int k=0;k<len;k++){
+      int hold = F::holds ? planRandom(p.rng, cfg.holdMinMs, cfg.holdMaxMs+1) : HOLD_FIXED_MS;
+      planPushTypo(p, textAt(i + k), c, hold);
+    }
+    // short pause then backspace the wrong chunk
+    p.tUs += (uint32_t)(std::max(40.0f, nextDelay) * 1000.0f);
+    for(int b=0;b<len;++b) planPushKey(p, HID_KEY_BACKSPACE, planRandom(p.rng, 20,60));
+    // then type the correct len characters normally (replay portion of text)
+    for(int r=0;r<len;++r){
+      int extraHold = F::holds ? planRandom(p.rng, cfg.holdMinMs, cfg.holdMaxMs+1) : HOLD_FIXED_MS;
+      planPush(p, textAt(i + r), extraHold, std::max(nextDelay*0.5f, (float)extraHold), EV_CHAR_DONE);
+    }
+    p.i = i + len;
+    p.mistakesCurrently++;
+  } else {
+    int extra = 0;
+    if(F::human && !strict){
+      if(isSpace) extra += planRandom(p.rng, 40,140);
+      if(cfg.punctPause && isPunct) extra += planRandom(p.rng, 80,220);
+      if(c == '\n' || c == '\r') extra += planRandom(p.rng, 120,320);
+    }
+    // key hold; strict mode (and a fixed hold) keeps it inside the interval so WPM stays exact
+    int hold = F::holds ? planRandom(p.rng, cfg.holdMinMs, cfg.holdMaxMs+1) : HOLD_FIXED_MS;
+    planPush(p, c, hold, nextDelay + extra + (F::holds && !strict ? hold : 0), EV_CHAR_DONE);
+    p.i = i + 1;
+    p.mistakesCurrently = 0;
+  }
+
+  if(F::pauses && !strict && isSpace && cfg.thinkChance>0 && (planRandom(p.rng, 0,cfg.thinkChance)==0)){
+    p.tUs += (uint32_t)planRandom(p.rng, 400,1000) * 1000u;
+  }
+  return true;
+}
+
+// Top the ring up while the player has slack before absolute deadline dueUs (0 = fill regardless of time)
+template<class F> static void planTopUp(Planner &p, int64_t dueUs){
+  while(plan.count + PLAN_STEP_MAX <= PLAN_CAP){
+    if(dueUs && engineIo->nowUs() + PLAN_GUARD_US > dueUs) break;
+    if(plan.count && !p.turbo && p.tUs > p.playUs + PLAN_AHEAD_US) break;
+    if(!planStep<F>(p)) break;
+  }
+  textRing.rd.store(p.i, std::memory_order_release); // planned chars are no longer needed
+}
+
+// Wait until at least minChars past p.i have arrived (or the upload ended). Returns false on stop.
+static bool waitForText(Planner &p, uint32_t minChars){
+  while(engineIo->running()){
+    if(textRing.eof.load(std::memory_order_acquire)) return true;
+    if(textRing.wr.load(std::memory_order_acquire) - p.i >= minChars) return true;
+    engineIo->waitText();
+  }
+  return false;
+}
+
+// Player: stream the plan to the HID layer at its deadlines
+template<class F> static void playPlan(Planner &p){
+  bool keyDown = false;
+  int64_t lastDownAt = 0;
+  for(;;){
+    // turbo has no human timing to protect, so keep the ring full for whole chords
+    if(p.turbo || plan.count == 0) planTopUp<F>(p, 0);
+    if(plan.count == 0){
+      if(p.done) break;
+      // upload is behind the typist: wait for more text without counting the gap against the schedule
+      int64_t w0 = engineIo->nowUs();
+      if(!waitForText(p, p.need)) break;
+      schedHold(engineIo->nowUs() - w0);
+      continue;
+    }
+    // nothing is in flight here: shift the queued events, the planner and the schedule together
+    if(plan.ev[plan.head].downUs >= PLAN_REBASE_US){
+      uint32_t us = plan.ev[plan.head].downUs;
+      for(uint16_t k=0, j=plan.head; k<plan.count; k++, j=(j+1)%PLAN_CAP){ plan.ev[j].downUs -= us; plan.ev[j].upUs -= us; }
+      planRebase(p, us);
+      sched.rebasedUs += us; planTotalUs -= us; schedShift(us);
+    }
+    KeyEvent e = plan.ev[plan.head];
+    if(!schedWaitUntil(e.downUs)) break;
+    if(!engineIo->hidReady()){
+      // nothing from plan.head on has been sent, so the plan is the checkpoint: typedChars, a half-corrected typo and
+      // the schedule pick up where they were once the host is back (the outage is held time, like a pause)
+      int64_t w0 = engineIo->nowUs();
+      hidWaiting = true;
+      bool back = engineIo->waitHid(HID_RESUME_WINDOW_MS);
+      hidWaiting = false;
+      if(!back){ if(engineIo->running()) metricAdd(metrics.hidLost); break; }
+      metricAdd(metrics.hidResumes);
+      schedHold(engineIo->nowUs() - w0);
+      continue;
+    }
+    // every event due at this instant goes into the same report
+    HidReport r = {};
+    uint8_t nk = 0, done = 0;
+    char gch[6]; uint8_t gfl[6];
+    while(plan.count && plan.ev[plan.head].downUs == e.downUs && (nk < 6 || !plan.ev[plan.head].key)){
+      KeyEvent &f = plan.ev[plan.head];
+      if(f.key){ gch[nk] = f.ch; gfl[nk] = f.flags; r.mod = f.mod; r.keys[nk++] = f.key; }
+      if(f.flags & EV_CHAR_DONE) done++;
+      plan.head = (plan.head + 1) % PLAN_CAP; plan.count--;
+    }
+    int64_t downAt = engineIo->nowUs();
+    if(nk){ engineIo->hidSend(r); keyDown = true; }
+    typedChars += done; // the host has them from the key-down on, so a stop before the key-up still counts them (resume)
+    if(done) rateSent(done, e.downUs);
+    if(nk && !probe.on){
+      int64_t late = downAt - (sched.startUs + e.downUs);
+      uint32_t lateUs = late > 0 ? (uint32_t)late : 0;
+      metricObserve(metrics.late, METRIC_LATE_LE_US, METRIC_LATE_BUCKETS, lateUs);
+      metricAdd(metrics.lateCount); metricAdd(metrics.lateSumUs, lateUs);
+      if(lastDownAt){
+        uint32_t iki = (uint32_t)(downAt - lastDownAt);
+        metricObserve(metrics.iki, METRIC_IKI_LE_US, METRIC_IKI_BUCKETS, iki);
+        metricAdd(metrics.ikiCount); metricAdd(metrics.ikiSumMs, (iki + 500) / 1000);
+      }
+      for(uint8_t k=0;k<nk;k++){
+        if(r.keys[k] == HID_KEY_BACKSPACE) metricAdd(metrics.backspaces);
+        else if(gfl[k] & EV_TYPO) metricAdd(metrics.typos);
+      }
+    }
+    p.playUs = e.downUs;
+    if(!p.turbo) planTopUp<F>(p, sched.startUs + e.upUs);
+    int64_t workUs = engineIo->nowUs() - downAt, upAt = 0;
+    if(!probe.on) metricAdd(metrics.workUs, (uint32_t)workUs);
+    if(!schedWaitUntil(e.upUs)) break;
+    if(probe.on) upAt = engineIo->nowUs();
+    if(keyDown){ hidAllUp(); keyDown = false; }
+    if(!probe.on) metricAdd(metrics.chars, done);
+    if(F::logging && p.cfg.logging && nk){
+      uint32_t hold = (uint32_t)(engineIo->nowUs() - downAt);
+      uint32_t iki = lastDownAt ? (uint32_t)(downAt - lastDownAt) : 0;
+      for(uint8_t k=0;k<nk;k++){
+        uint8_t type = (r.keys[k] == HID_KEY_BACKSPACE) ? LOG_BACKSPACE : (gfl[k] & EV_TYPO) ? LOG_TYPO : LOG_KEY;
+        engineIo->logKey(type, gch[k], downAt, iki, hold);
+      }
+    }
+    if(nk) lastDownAt = downAt;
+    if(probe.on) probeKey(downAt - (sched.startUs + e.downUs), (uint32_t)(workUs + engineIo->nowUs() - upAt));
+  }
+  if(keyDown) hidAllUp();
+}
+
+// ---------------- Typing engine ----------------
+// Plans the text in textRing (already newline/code-mode filtered) and plays it. expected: final length if known
+// (0 = unknown). fixed (bench, host harness): use that config with a fixed seed and no per-session WPM variation,
+// ignoring later config changes. F: the build's feature policy.
+#define BENCH_SEED 0x5eed1234u
+template<class F = FeaturesPro> void typeLikeHuman(uint32_t expected, const EngineConfig *fixed = NULL){
+  if(!engineIo->hidReady()) return;
+
+  typedChars = 0;
+  jobChars = expected;
+  if(!fixed) metricAdd(metrics.jobs);
+
+  Planner p;
+  p.i = 0; p.N = expected;
+  p.tUs = 0; p.playUs = 0; p.rng.seed(fixed ? BENCH_SEED : engineIo->seed());
+  p.iki.setSigma(0.7f); // higher sigma -> heavier tails
+  p.cfgSeen = cfgVersion(); p.cfg = fixed ? *fixed : cfgSnapshot(); p.cfgLive = !fixed;
+  // per-session speed multiplier and randomization (strict mode types exactly the configured WPM)
+  p.speedMul = (fixed || !F::human || F::flat) ? 1.0f : 1.0f + (p.rng.range(-10,11)/100.0f); // +/-10%
+  p.wpmOffset = (fixed || !F::human) ? 0 : p.rng.range(-2,3);
+  planApplyConfig<F>(p);
+  p.code = F::codeMode && textRing.code; p.replay = F::replay && textRing.plan; p.need = 1; p.emit = false; p.done = false; p.wordStart = false;
+  p.turbo = F::turbo && p.cfg.turbo; p.gCount = 0; p.gMod = 0;
+  p.mistakesCurrently = 0; p.integ = 0; p.refI = 0; p.refMs = 0;
+
+  if(!waitForText(p, TEXT_PREROLL)) return;
+  if(textRing.eof.load() && textRing.wr.load() == 0) return;
+
+  if(F::replay && p.replay){
+    // an uploaded plan states its own length
+    if(!planReplayHeader(p)) return;
+  } else {
+    // dry run with the same RNG state estimates the plan's length for everything already buffered. It is
+    // approximate: playback's drift correction (PI lag) and config reloads at word boundaries change the real timing,
+    // and the part of a large upload that hasn't arrived yet is extrapolated at the same rate
+    Planner dry = p;
+    planTotalUs = 0;
+    while(planStep<F>(dry)){ if(dry.tUs >= PLAN_REBASE_US){ planTotalUs += dry.tUs; planRebase(dry, dry.tUs); } }
+    planTotalUs += dry.tUs + (dry.gCount ? 2 * TURBO_REPORT_US : 0);
+    if(!dry.done && dry.i > 0 && dry.N > dry.i) planTotalUs += planTotalUs * (dry.N - dry.i) / dry.i;
+  }
+  if(p.turbo) engineIo->turbo(true);
+
+  p.emit = true;
+  rateBegin();
+  plan.head = plan.count = 0;
+  planTopUp<F>(p, 0);
+  schedBegin();
+  playPlan<F>(p);
+  if(p.turbo) engineIo->turbo(false);
+}
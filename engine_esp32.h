@@ -0,0 +1,281 @@
+/*
+  engine_esp32.h — engine.h on an ESP32 with BleKeyboard, shared by every sketch in this folder
+
+  Typer-task run/stop/pause state (event group + task notifications), the textRing producer side (filtered
+  or raw uploads) and EspIo: esp_timer clock and deadline waits, BleKeyboard HID reports. A sketch includes it
+  after engine.h and after declaring `BleKeyboard bleKeyboard`, calls espEngineBegin() in setup(), creates its
+  typer task into typerTaskHandle and runs typeLikeHuman<Policy>() there, and calls bleLinkPoll() regularly from
+  another task. Boot: setup() hands its Wi-Fi/HTTP bring-up to bootNetBegin() and starts BLE itself, marking the
+  checkpoints below; the sketch serves bootJson() on GET /boot.
+*/
+#pragma once
+#include <BleKeyboard.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/event_groups.h>
+#include <esp_timer.h>
+#include <esp_system.h>
+#include <esp_idf_version.h>
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
+#if defined(USE_NIMBLE)
+#include <NimBLEDevice.h>
+#else
+#include <BLEDevice.h>
+#endif
+#include "engine.h"
+
+// ---------------- Typer state ----------------
+// Run/stop/pause state lives in an event group so both cores see it coherently; stop and pause also notify the
+// typer so waits end immediately.
+#define SERVER_CORE 0
+#define TYPER_CORE 1
+#define EVT_TYPING (1 << 0)   // a job has been accepted and is not finished yet
+#define EVT_STOP   (1 << 1)   // stop requested for the current job
+#define EVT_RESUME (1 << 2)   // cleared while paused
+EventGroupHandle_t typerEvents = NULL;
+TaskHandle_t typerTaskHandle = NULL;
+
+static inline bool typingActive(){ EventBits_t b = xEventGroupGetBits(typerEvents); return (b & EVT_TYPING) && !(b & EVT_STOP); }
+static inline bool isPaused(){ return !(xEventGroupGetBits(typerEvents) & EVT_RESUME); }
+
+// Wake the typer out of scheduler/pause waits so stop and pause take effect immediately
+static inline void notifyTyper(){ if(typerTaskHandle) xTaskNotifyGive(typerTaskHandle); }
+void requestStop(){ xEventGroupSetBits(typerEvents, EVT_STOP | EVT_RESUME); notifyTyper(); }
+void setPaused(bool p){
+  if(p) xEventGroupClearBits(typerEvents, EVT_RESUME); else xEventGroupSetBits(typerEvents, EVT_RESUME);
+  notifyTyper();
+}
+
+// Block the typer while paused (returns at once on resume or stop)
+void waitWhilePaused(){
+  while(typingActive() && isPaused()) xEventGroupWaitBits(typerEvents, EVT_RESUME | EVT_STOP, pdFALSE, pdFALSE, portMAX_DELAY);
+}
+
+// ---------------- Text ring producer ----------------
+// Producer side: append one filtered char, waiting for the planner to free space when the ring is full.
+// Returns false if the job was stopped (the rest of the upload is discarded).
+bool textRingPut(char c){
+  while(textRing.wr.load(std::memory_order_relaxed) - textRing.rd.load(std::memory_order_acquire) >= TEXT_RING_SIZE){
+    if(!typingActive()) return false;
+    vTaskDelay(1);
+  }
+  uint32_t w = textRing.wr.load(std::memory_order_relaxed);
+  textRing.buf[w & (TEXT_RING_SIZE - 1)] = (uint8_t)c;
+  textRing.wr.store(w + 1, std::memory_order_release);
+  return true;
+}
+
+// Free space in the ring: feeding at most this many body bytes never waits (filtering only shrinks text)
+static inline uint32_t textRingFree(){
+  return TEXT_RING_SIZE - (textRing.wr.load(std::memory_order_relaxed) - textRing.rd.load(std::memory_order_acquire));
+}
+
+TextTransform textTransform;
+
+void feedChunk(const uint8_t *in, size_t n){
+  const uint8_t *end = in + n; char c;
+  while(textTransform.next(in, end, c)){ if(!textRingPut(c)) break; }
+  notifyTyper(); // new text for a planner that ran dry
+}
+
+// Raw bytes into the ring, unfiltered (uploaded keystroke plans)
+void feedRaw(const uint8_t *in, size_t n){
+  for(size_t i = 0; i < n; i++){ if(!textRingPut((char)in[i])) break; }
+  notifyTyper();
+}
+
+// Reset the ring for a new job (only while no job is running)
+void textRingBegin(uint32_t expected, bool plan = false){
+  textRing.wr.store(0); textRing.rd.store(0); textRing.eof.store(false);
+  EngineConfig c = cfgSnapshot();
+  textRing.expected = expected; textRing.code = c.codeMode; textRing.plan = plan;
+  textTransform.begin(c.codeMode, (uint8_t)c.newlineMode);
+}
+
+void textRingEnd(){ textRing.eof.store(true, std::memory_order_release); notifyTyper(); }
+
+// ---------------- Power ----------------
+// Nothing needs a fast CPU between jobs or across the longer waits inside one (the gap after a key-up, think and
+// long pauses, pause, a slow upload). With the ESP-IDF power manager the board then drops to POWER_MIN_MHZ and,
+// when the core was built with tickless idle, light-sleeps (the radios keep their own locks while they need the
+// clock). The typer holds the two locks below whenever a deadline is close: EspIo lets go for waits longer than
+// POWER_SLEEP_MIN_US and wakes POWER_WAKE_US early, so the final stretch runs at full speed as before.
+// Time with and without the locks is accumulated for /bench's energy estimate.
+#define POWER_MAX_MHZ 240
+#define POWER_MIN_MHZ 40            // XTAL; Wi-Fi and BLE raise it (APB lock) while they're busy
+#define POWER_SLEEP_MIN_US 10000    // shorter waits stay awake
+#define POWER_WAKE_US 2000          // light-sleep exit + clock switch, with margin
+enum { POWER_OFF, POWER_DFS, POWER_LIGHT_SLEEP };
+static const char *const POWER_MODE_NAMES[] = { "off", "dfs", "light-sleep" };
+uint8_t powerMode = POWER_OFF;
+static bool powerHeld = false;
+static int64_t powerSinceUs = 0;
+int64_t powerBusyUs = 0, powerIdleUs = 0;   // typer task only
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t pmCpuLock = NULL, pmAwakeLock = NULL;
+#endif
+
+void powerBegin(){
+#if CONFIG_PM_ENABLE
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_pm_config_t pc = {};
+#else
+  esp_pm_config_esp32_t pc = {};
+#endif
+  pc.max_freq_mhz = POWER_MAX_MHZ; pc.min_freq_mhz = POWER_MIN_MHZ; pc.light_sleep_enable = true;
+  if(esp_pm_configure(&pc) == ESP_OK) powerMode = POWER_LIGHT_SLEEP;
+  else { pc.light_sleep_enable = false; if(esp_pm_configure(&pc) == ESP_OK) powerMode = POWER_DFS; } // no tickless idle
+  esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "typer_cpu", &pmCpuLock);
+  esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "typer_awake", &pmAwakeLock);
+#endif
+  powerSinceUs = esp_timer_get_time();
+}
+
+// Bring powerBusyUs / powerIdleUs up to now
+void powerTally(){
+  int64_t now = esp_timer_get_time();
+  (powerHeld ? powerBusyUs : powerIdleUs) += now - powerSinceUs;
+  powerSinceUs = now;
+}
+
+// Typer task: full speed and no light sleep while on (a job is running and a deadline is close)
+void powerHold(bool on){
+  if(on == powerHeld) return;
+  powerTally(); powerHeld = on;
+#if CONFIG_PM_ENABLE
+  if(pmCpuLock){
+    if(on){ esp_pm_lock_acquire(pmCpuLock); esp_pm_lock_acquire(pmAwakeLock); }
+    else { esp_pm_lock_release(pmAwakeLock); esp_pm_lock_release(pmCpuLock); }
+  }
+#endif
+}
+
+// ---------------- Engine I/O (ESP32) ----------------
+// esp_timer clock, typer-task notifications and event bits, BleKeyboard reports.
+// The typer sleeps on a one-shot esp_timer and spins only the last SCHED_SPIN_US for sub-tick accuracy.
+#define SCHED_SPIN_US 150          // final stretch spun on esp_timer_get_time()
+#define BLE_RESUME_SETTLE_MS 400   // after a reconnect, before the job's next report
+esp_timer_handle_t typerWakeTimer = NULL;
+void typerWakeCb(void *arg){ notifyTyper(); }
+
+struct EspIo : EngineIo {
+  int64_t nowUs() override { return esp_timer_get_time(); }
+  void sleepUntil(int64_t due) override {
+    int64_t left = due - esp_timer_get_time();
+    if(left <= SCHED_SPIN_US){ while(esp_timer_get_time() < due){} return; }
+    bool idle = left > POWER_SLEEP_MIN_US; // returns POWER_WAKE_US early; the caller's next call spins the rest
+    if(idle) powerHold(false);
+    esp_timer_start_once(typerWakeTimer, (uint64_t)(left - (idle ? POWER_WAKE_US : SCHED_SPIN_US)));
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // timer, stop, pause or new text
+    esp_timer_stop(typerWakeTimer);
+    if(idle) powerHold(true);
+  }
+  bool running() override { return typingActive(); }
+  bool paused() override { return isPaused(); }
+  void waitResume() override { powerHold(false); waitWhilePaused(); powerHold(true); }
+  void waitText() override { powerHold(false); ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(20)); powerHold(true); }
+  uint32_t seed() override { return esp_random(); }
+  bool hidReady() override { return bleKeyboard.isConnected(); }
+  void hidSend(const HidReport &h) override {
+    KeyReport r; r.modifiers = h.mod; r.reserved = 0; memcpy(r.keys, h.keys, 6);
+    bleKeyboard.sendReport(&r);
+  }
+  // A bonded host re-encrypts and re-subscribes to the report characteristic a moment after the link is back, so
+  // hold off BLE_RESUME_SETTLE_MS before the first report. Stop ends the wait at once.
+  bool waitHid(uint32_t ms) override {
+    int64_t until = esp_timer_get_time() + (int64_t)ms * 1000;
+    bool back = true;
+    powerHold(false);
+    while(back && !bleKeyboard.isConnected()){
+      if(!typingActive() || esp_timer_get_time() >= until) back = false;
+      else ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(50));
+    }
+    int64_t settled = esp_timer_get_time() + BLE_RESUME_SETTLE_MS * 1000LL;
+    while(back && typingActive() && esp_timer_get_time() < settled) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BLE_RESUME_SETTLE_MS));
+    powerHold(true);
+    return back && typingActive() && bleKeyboard.isConnected();
+  }
+};
+
+// Event group, wake timer, power manager and sampler tables; io becomes the engine's platform. Call once from
+// setup(). The typer task wraps each job in powerHold(true) / powerHold(false).
+void espEngineBegin(EngineIo *io){
+  ziggurat.init();
+  powerBegin();
+  engineIo = io;
+  typerEvents = xEventGroupCreate();
+  xEventGroupSetBits(typerEvents, EVT_RESUME);
+  esp_timer_create_args_t wakeArgs = {};
+  wakeArgs.callback = typerWakeCb;
+  wakeArgs.name = "typer_wake";
+  esp_timer_create(&wakeArgs, &typerWakeTimer);
+}
+
+// ---------------- Boot timing ----------------
+// esp_timer µs (counted from early app startup) at each bring-up checkpoint, written once; served on /boot
+enum { BOOT_SETUP, BOOT_CONFIG, BOOT_BLE, BOOT_AP, BOOT_HTTP, BOOT_READY, BOOT_BLE_CONNECTED, BOOT_MARKS };
+static const char *const BOOT_NAMES[BOOT_MARKS] = { "setup", "config", "ble", "ap", "http", "ready", "bleConnected" };
+volatile uint32_t bootUs[BOOT_MARKS];
+std::atomic<int> bootPending(2);   // BLE and network bring-up; the last one to finish marks BOOT_READY
+
+static inline void bootMark(int m){ if(!bootUs[m]) bootUs[m] = (uint32_t)esp_timer_get_time(); }
+static inline void bootStepDone(){ if(bootPending.fetch_sub(1) == 1) bootMark(BOOT_READY); }
+
+// {"setup":us,...,"bleConnected":us,"now":us} (0 = not reached yet), the body of GET /boot
+#define BOOT_JSON_MAX (48 + BOOT_MARKS * 28)
+void bootJson(char *buf, size_t n){
+  size_t k = snprintf(buf, n, "{");
+  for(int i=0;i<BOOT_MARKS;i++) k += snprintf(buf + k, n - k, "\"%s\":%u,", BOOT_NAMES[i], (unsigned)bootUs[i]);
+  snprintf(buf + k, n - k, "\"now\":%u}", (unsigned)esp_timer_get_time());
+}
+
+// The radios come up in parallel: netStart (soft-AP, then the HTTP server) runs in its own task on the server core
+// while setup() runs bleKeyboard.begin() on the loop task, with no fixed delays in between
+static void bootNetTask(void *arg){
+  ((void (*)())arg)();
+  bootStepDone();
+  vTaskDelete(NULL);
+}
+static inline void bootNetBegin(void (*netStart)()){
+  xTaskCreatePinnedToCore(bootNetTask, "net", 4096, (void*)netStart, 2, NULL, SERVER_CORE);
+}
+
+// ---------------- BLE reconnect ----------------
+// BleKeyboard bonds and the BLE stack keeps the keys in NVS, so a known host reconnects and re-encrypts without
+// pairing again; what decides how soon is how often we advertise. From boot and after every drop we advertise
+// every 20–30 ms for HID_RESUME_WINDOW_MS (the time a job waits for the host), then every 152.5–211.25 ms —
+// still inside the intervals Apple's accessory guidelines list for discovery — so an idle board isn't shouting.
+#define ADV_FAST_MIN 32    // 0.625 ms units
+#define ADV_FAST_MAX 48
+#define ADV_SLOW_MIN 244
+#define ADV_SLOW_MAX 338
+static bool bleWasUp = false, bleAdvFast = true;
+static int64_t bleDownUs = 0;
+
+static void bleAdvertise(bool fast){
+#if defined(USE_NIMBLE)
+  NimBLEAdvertising *a = NimBLEDevice::getAdvertising();
+#else
+  BLEAdvertising *a = BLEDevice::getAdvertising();
+#endif
+  a->stop();
+  a->setMinInterval(fast ? ADV_FAST_MIN : ADV_SLOW_MIN);
+  a->setMaxInterval(fast ? ADV_FAST_MAX : ADV_SLOW_MAX);
+  if(!bleKeyboard.isConnected()) a->start();
+  bleAdvFast = fast;
+}
+
+// Poll from a task other than the typer (cheap enough for every loop). Returns true once per connection drop.
+bool bleLinkPoll(){
+  if(!bootUs[BOOT_BLE]) return false; // bleKeyboard.begin() hasn't run yet (network comes up in parallel)
+  bool up = bleKeyboard.isConnected();
+  if(up) bootMark(BOOT_BLE_CONNECTED);
+  int64_t now = esp_timer_get_time();
+  bool dropped = bleWasUp && !up;
+  if(dropped){ bleDownUs = now; bleAdvertise(true); }
+  else if(!up && bleAdvFast && now - bleDownUs > HID_RESUME_WINDOW_MS * 1000LL) bleAdvertise(false);
+  bleWasUp = up;
+  return dropped;
+}
@@ -3,15 +3,25 @@
   - When Code Mode is ON, every line will have ALL leading whitespace removed
     (spaces, tabs and other non-newline whitespace). CRLF/LF normalized to '\n'.
   - Everything else (timing, typos, pause/stop, UI) left intact.
+  - Planning and playback run on the shared engine (engine.h, engine_esp32.h) with the FeaturesClassic policy;
+    build with -DTYPIST_STRICT_ONLY for the lean strict-WPM engine.
+  - BLE and the Wi-Fi AP come up in parallel with no fixed delays; /boot reports the boot checkpoint timings.
 */
 
 #include <WiFi.h>
 #include <WebServer.h>
 #include <BleKeyboard.h>
 #include <ctype.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/event_groups.h>
+#include "sampler.h"
+#include "engine.h"
 
 // BLE identity
 BleKeyboard bleKeyboard("Logitech K380", "Logitech", 100);
+#include "engine_esp32.h"
 
 // WiFi AP
 const char* AP_SSID = "ESP32_Control";
@@ -19,30 +29,25 @@ const char* AP_PASS = "qwertyuiop120";
 
 WebServer server(80);
 
-// Runtime config (defaults)
-volatile int configuredWPM = 100;
-volatile bool strictWPM = false;
-volatile int jitterStrengthPct = 12;
-volatile int thinkingSpaceChance = 0;
-volatile int mistakePercent = 3;
-volatile bool enableTypos = true;
-volatile bool enableLongPauses = true;
-volatile int longPausePercent = 5;
-volatile int longPauseMinMs = 600;
-volatile int longPauseMaxMs = 1200;
-volatile int newlineMode = 1; // 0 keep,1 space,2 remove
-volatile bool extraPunctPause = true;
-
-// Code mode config (single toggle)
-volatile bool codeMode = false;    // OFF by default
-
-// Runtime state
-volatile bool typingActive = false;
-volatile bool paused = false; // pause/resume state
-volatile unsigned long typedChars = 0;
+// Runtime config: the engine's EngineConfig (engine.h), whose defaults are this sketch's. Handlers edit a
+// snapshot and publish it; a running job picks the change up at its next word.
+
+// Engine build: the original humanization. Define TYPIST_STRICT_ONLY for the lean strict-WPM engine, which
+// compiles out typos, pauses, jitter and every RNG draw.
+#if defined(TYPIST_STRICT_ONLY)
+typedef FeaturesStrict SketchFeatures;
+#else
+typedef FeaturesClassic SketchFeatures;
+#endif
+
+// Cross-core job handoff: serverTask (core 0) services HTTP and feeds the body into textRing, typerTask (core 1)
+// runs typeLikeHuman. Run/stop/pause state is engine_esp32.h's event group.
+QueueHandle_t jobQueue = NULL;        // uint32_t: length of the body being fed
+TaskHandle_t serverTaskHandle = NULL;
+EspIo espIo;
 
 // HTML UI
-const char INDEX_HTML[] PROGMEM = R"rawliteral(
+constexpr char INDEX_HTML[] PROGMEM = R"rawliteral(
 <!doctype html>
 <html lang="en"><head><meta charset="utf-8"/><meta name="viewport" content="width=device-width,initial-scale=1"/>
 <title>ESP32 BLE Typist</title>
@@ -194,345 +199,195 @@ getStatus();
 </script>
 </body></html>
 )rawliteral";
+#include "ui_esp32.h"
 
 // Utilities
 String readRequestBody(){ if(server.hasArg("plain")) return server.arg("plain"); return String(); }
-int clampInt(int v,int a,int b){ if(v<a) return a; if(v>b) return b; return v; }
-static inline float ms_per_char_for_wpm(int wpm){ if(wpm<1) wpm=1; return 60000.0f / (wpm * 5.0f); }
-
-// Cooperative delay that allows STOP + HTTP handling during waits
-void coopDelay(unsigned long ms){
-  unsigned long start = millis();
-  while(typingActive && (millis() - start < ms)){
-    server.handleClient();
-    // If paused, remain responsive to HTTP but don't advance time-based waits
-    while(paused && typingActive){
-      server.handleClient();
-      delay(1);
-      yield();
-    }
-    delay(1);
-    yield();
-  }
-}
 
-void sendChar(char c){ bleKeyboard.print(c); }
-void sendBackspace(){ bleKeyboard.write(KEY_BACKSPACE); }
-
-// Preprocess newline handling (non-code mode)
-String preprocessText(const String &in){
-  if(newlineMode==0) return in;
-  String out; out.reserve(in.length());
-  for(size_t i=0;i<in.length();++i){
-    char c = in[i];
-    if(c == '\r' || c == '\n'){
-      if(newlineMode == 1) out += ' ';
-      // if mode 2 => drop entirely
-    } else {
-      out += c;
-    }
-  }
-  return out;
-}
-
-// Small helper to cap jitter at very high WPM
-static inline float capJitterForWPM(int wpm, float jpct){ if(wpm >= 140 && jpct > 0.08f) return 0.08f; return jpct; }
-
-// Typing engine — Code Mode: strip ALL leading non-newline whitespace per-line, then type
-void typeLikeHuman(const String &rawText){
-  if(!bleKeyboard.isConnected()) return;
-
-  // If code mode OFF, use existing pipeline with newline preprocessing
-  if(!codeMode){
-    String text = preprocessText(rawText);
-    size_t N = text.length();
-    if(N == 0) return;
-
-    typingActive = true;
-    paused = false; // ensure not paused when starting
-    typedChars = 0;
-
-    int sessionWPM = clampInt(configuredWPM + random(-2,3), 10, 300);
-    float baseMs = ms_per_char_for_wpm(sessionWPM);
-    float jitterPct = clampInt(jitterStrengthPct,5,45) / 100.0f;
-    jitterPct = capJitterForWPM(sessionWPM, jitterPct);
-    bool strict = strictWPM;
-
-    const float MIN_DELAY = 6.0f; const float CORR_LIMIT = 0.5f;
-    unsigned long startMs = millis();
-
-    for(size_t i=0;i<N && typingActive;++i){
-      if(!bleKeyboard.isConnected()) break;
-
-      // If paused, wait here (still service HTTP)
-      while(paused && typingActive){ server.handleClient(); delay(1); yield(); }
-
-      unsigned long now = millis(); float elapsed = float(now - startMs);
-      size_t remaining = (N - i); if(remaining==0) remaining = 1;
-      float idealElapsed = float(i) * baseMs;
-      float error = elapsed - idealElapsed;
-      float correction = -error / float(remaining);
-      if(correction > baseMs*CORR_LIMIT) correction = baseMs*CORR_LIMIT;
-      if(correction < -baseMs*CORR_LIMIT) correction = -baseMs*CORR_LIMIT;
-
-      float nextDelay = baseMs + correction; if(nextDelay < MIN_DELAY) nextDelay = MIN_DELAY;
-      float jitterFactor = 1.0f + ((random(-1000,1001)/1000.0f) * jitterPct);
-      nextDelay *= jitterFactor; if(nextDelay < MIN_DELAY) nextDelay = MIN_DELAY;
-
-      char c = text[i];
-      bool isSpace = (c==' ');
-      bool isPunct = (c=='.'||c==','||c=='!'||c=='?'||c==';'||c==':');
-
-      if(!strict && enableLongPauses && isSpace && (random(0,100) < longPausePercent)){
-        coopDelay(random(longPauseMinMs, longPauseMaxMs+1)); if(!typingActive) break;
-      }
-
-      bool alnum = ((c>='a'&&c<='z')||(c>='A'&&c<='Z')||(c>='0'&&c<='9'));
-      bool makeTypo = (!strict) && enableTypos && (random(0,100) < mistakePercent) && alnum;
-      if(makeTypo){
-        char wrong = char('a' + (random(0,25)));
-        if(isupper(c)) wrong = toupper(wrong);
-        sendChar(wrong);
-        coopDelay(max(60, (int)nextDelay)); if(!typingActive) break;
-        sendBackspace(); coopDelay(random(110,380)); if(!typingActive) break;
-        sendChar(c); coopDelay(clampInt((int)(nextDelay*0.5f)+random(20,120), 20, 800)); if(!typingActive) break;
-      } else {
-        sendChar(c);
-        int extra = 0;
-        if(!strict){
-          if(isSpace) extra += random(40,140);
-          if(extraPunctPause && isPunct) extra += random(80,220);
-          if(c == '\n' || c == '\r') extra += random(120,320);
-        }
-        coopDelay((unsigned long)nextDelay + extra); if(!typingActive) break;
-      }
-
-      if(!strict && isSpace && thinkingSpaceChance>0 && (random(0,thinkingSpaceChance)==0)){
-        coopDelay(random(400,1000)); if(!typingActive) break;
-      }
-
-      typedChars = i+1;
-    }
-
-    typingActive = false; paused = false; // clear paused state when finished
-    coopDelay(120 + random(0,300));
-    return;
-  }
-
-  // ---------------- Code Mode ON: build filtered text that strips leading whitespace per-line
-  {
-    String raw = rawText;
-    int inN = (int)raw.length();
-    if(inN == 0) return;
-
-    String text;
-    text.reserve(inN);
-    bool startOfLine = true;
-
-    for(int i = 0; i < inN; ++i){
-      char c = raw[i];
-
-      // Handle CR and CRLF -> normalized to single '\n'
-      if(c == '\r'){
-        if((i + 1) < inN && raw[i+1] == '\n'){ ++i; } // skip LF after CR
-        text += '\n';
-        startOfLine = true;
-        continue;
-      }
-      // Handle LF
-      if(c == '\n'){
-        text += '\n';
-        startOfLine = true;
-        continue;
-      }
-
-      // At this point c is NOT '\r' or '\n'.
-      // If we're at start of line and c is whitespace (space, tab, etc.), skip it.
-      // We purposely use isspace but we've already handled newline chars above.
-      if(startOfLine && isspace((unsigned char)c)){
-        // drop leading whitespace (space, tab, vertical-tab, form-feed, etc.)
-        continue;
-      }
-
-      // Otherwise append and mark not at start-of-line
-      text += c;
-      startOfLine = false;
-    }
-
-    // Now type the filtered text using your engine
-    int N = (int)text.length();
-    if(N == 0) return;
-
-    typingActive = true;
-    paused = false;
-    typedChars = 0;
-
-    int sessionWPM = clampInt(configuredWPM + random(-2,3), 10, 300);
-    float baseMs = ms_per_char_for_wpm(sessionWPM);
-    float jitterPct = clampInt(jitterStrengthPct,5,45) / 100.0f;
-    jitterPct = capJitterForWPM(sessionWPM, jitterPct);
-    bool strict = strictWPM;
-
-    const float MIN_DELAY = 6.0f; const float CORR_LIMIT = 0.5f;
-    unsigned long startMs = millis();
-
-    for(int i=0; i < N && typingActive; ++i){
-      if(!bleKeyboard.isConnected()) break;
-
-      // If paused, wait here (still service HTTP)
-      while(paused && typingActive){ server.handleClient(); delay(1); yield(); }
-
-      unsigned long now = millis(); float elapsed = float(now - startMs);
-      int remaining = (N - i); if(remaining==0) remaining = 1;
-      float idealElapsed = float(i) * baseMs;
-      float error = elapsed - idealElapsed;
-      float correction = -error / float(remaining);
-      if(correction > baseMs*CORR_LIMIT) correction = baseMs*CORR_LIMIT;
-      if(correction < -baseMs*CORR_LIMIT) correction = -baseMs*CORR_LIMIT;
-
-      float nextDelay = baseMs + correction; if(nextDelay < MIN_DELAY) nextDelay = MIN_DELAY;
-      float jitterFactor = 1.0f + ((random(-1000,1001)/1000.0f) * jitterPct);
-      nextDelay *= jitterFactor; if(nextDelay < MIN_DELAY) nextDelay = MIN_DELAY;
-
-      char c = text[i];
-
-      // newline handling (we normalized CRLF -> '\n')
-      if(c == '\n'){
-        sendChar('\n');
-        coopDelay((unsigned long)nextDelay);
-        typedChars = i+1;
-        continue;
-      }
-
-      bool isSpace = (c == ' ');
-      bool isPunct = (c=='.'||c==','||c=='!'||c=='?'||c==';'||c==':');
-
-      if(!strict && enableLongPauses && isSpace && (random(0,100) < longPausePercent)){
-        coopDelay(random(longPauseMinMs, longPauseMaxMs+1)); if(!typingActive) break;
-      }
-
-      bool alnum = ((c>='a'&&c<='z')||(c>='A'&&c<='Z')||(c>='0'&&c<='9'));
-      bool makeTypo = (!strict) && enableTypos && (random(0,100) < mistakePercent) && alnum;
-
-      if(makeTypo){
-        char wrong = char('a' + (random(0,25)));
-        if(isupper(c)) wrong = toupper(wrong);
-        sendChar(wrong);
-        coopDelay(max(60, (int)nextDelay)); if(!typingActive) break;
-        sendBackspace(); coopDelay(random(110,380)); if(!typingActive) break;
-        sendChar(c); coopDelay(clampInt((int)(nextDelay*0.5f)+random(20,120), 20, 800)); if(!typingActive) break;
-      } else {
-        sendChar(c);
-        int extra = 0;
-        if(!strict){
-          if(isSpace) extra += random(40,140);
-          if(extraPunctPause && isPunct) extra += random(80,220);
-          if(c=='\n' || c=='\r') extra += random(120,320);
-        }
-        coopDelay((unsigned long)nextDelay + extra); if(!typingActive) break;
-      }
-
-      if(!strict && isSpace && thinkingSpaceChance>0 && (random(0,thinkingSpaceChance)==0)){
-        coopDelay(random(400,1000)); if(!typingActive) break;
-      }
-
-      typedChars = i+1;
-    }
-
-    typingActive = false;
-    paused = false; // clear paused state when finished
-    coopDelay(120 + random(0,300));
-    return;
+// The running job's body not yet in textRing. serverTask moves whatever fits between requests, so /stop and
+// /pause are served while a long text is typed; a stopped job's rest is dropped.
+// The request's String buffer is moved in, not copied, and dropped once fed.
+String pendingBody;
+bool pendingActive = false;
+size_t pendingPos = 0;
+void feedPending(){
+  if(!pendingActive) return;
+  if(typingActive()){
+    size_t n = std::min((size_t)textRingFree(), (size_t)pendingBody.length() - pendingPos);
+    if(n){ feedChunk((const uint8_t*)pendingBody.c_str() + pendingPos, n); pendingPos += n; }
+    if(pendingPos < pendingBody.length()) return;
   }
+  pendingBody = String(); pendingActive = false;
+  textRingEnd();
 }
 
 // HTTP Handlers
-void handleRoot(){ server.send_P(200, "text/html", INDEX_HTML); }
+// Web UI: pre-gzipped copy of INDEX_HTML from flash (tools/gzip_ui.py) with an ETag, so repeat loads are a bodyless 304.
+// The raw page is only hashed at compile time and never linked, unless built with -DTYPIST_UI_DEV (serves it as is,
+// for editing the UI without re-running the script). A ui_*.h left stale by a UI edit fails the build.
+static constexpr uint32_t fnv1a(const char *s){ uint32_t h = 2166136261u; while(*s){ h ^= (uint8_t)*s++; h *= 16777619u; } return h; }
+static constexpr uint32_t UI_HASH = fnv1a(INDEX_HTML);
+#ifndef TYPIST_UI_DEV
+static_assert(UI_HASH == INDEX_HTML_HASH, "web UI changed since tools/gzip_ui.py last ran: re-run it (or build with -DTYPIST_UI_DEV)");
+#endif
+static char uiEtag[16];
+void uiInit(){
+  snprintf(uiEtag, sizeof(uiEtag), "\"%08x\"", (unsigned)UI_HASH);
+}
+void handleRoot(){
+  server.sendHeader("Cache-Control", "no-cache"); // always revalidate, so a reflashed UI shows up at once
+  server.sendHeader("ETag", uiEtag);
+  if(server.header("If-None-Match") == uiEtag){ server.send(304); return; }
+#ifdef TYPIST_UI_DEV
+  server.send_P(200, "text/html", INDEX_HTML);
+#else
+  server.sendHeader("Content-Encoding", "gzip"); // the only copy in flash; every browser accepts it
+  server.send_P(200, "text/html", (const char*)INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ));
+#endif
+}
 
+// One fixed buffer instead of a String built per poll (handlers run one at a time in serverTask)
+static char statusBuf[384];
+#define JB(v) ((v) ? "true" : "false")
 void handleStatus(){
-  String s = "{";
-  s += "\"ble\":" + String(bleKeyboard.isConnected()?"true":"false") + ",";
-  s += "\"wpm\":" + String(configuredWPM) + ",";
-  s += "\"strict\":" + String(strictWPM?"true":"false") + ",";
-  s += "\"jitter\":" + String(jitterStrengthPct) + ",";
-  s += "\"think\":" + String(thinkingSpaceChance) + ",";
-  s += "\"typos\":" + String(enableTypos?"true":"false") + ",";
-  s += "\"lpen\":" + String(enableLongPauses?"true":"false") + ",";
-  s += "\"nl\":" + String(newlineMode) + ",";
-  s += "\"codemode\":" + String(codeMode?"true":"false") + ",";
-  s += "\"typed\":" + String((unsigned long)typedChars) + ",";
-  s += "\"running\":" + String(typingActive?"true":"false") + ",";
-  s += "\"paused\":" + String(paused?"true":"false") + ",";
-  s += "\"state\":\"" + String(typingActive?"Typing...":"Ready.") + "\"";
-  s += "}";
-  server.send(200, "application/json", s);
+  EngineConfig c = cfgSnapshot();
+  bool on = typingActive();
+  snprintf(statusBuf, sizeof(statusBuf),
+    "{\"ble\":%s,\"wpm\":%d,\"strict\":%s,\"jitter\":%d,\"think\":%d,\"typos\":%s,\"lpen\":%s,\"nl\":%d,"
+    "\"codemode\":%s,\"typed\":%lu,\"running\":%s,\"paused\":%s,\"heap\":%u,\"heapMin\":%u,\"state\":\"%s\"}",
+    JB(bleKeyboard.isConnected()), c.wpm, JB(c.strict), c.jitterPct, c.thinkChance, JB(c.typos), JB(c.longPauses),
+    c.newlineMode, JB(c.codeMode), (unsigned long)typedChars, JB(on), JB(isPaused()),
+    (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMinFreeHeap(), on ? (hidWaiting ? "Waiting for BLE..." : "Typing...") : "Ready.");
+  server.send(200, "application/json", statusBuf);
 }
 
 void handleConfig(){
+  EngineConfig c = cfgSnapshot();
   bool changed=false;
-  if(server.hasArg("wpm")){ configuredWPM = clampInt(server.arg("wpm").toInt(), 10, 300); changed=true; }
-  if(server.hasArg("strict")){ strictWPM = (server.arg("strict").toInt()!=0); changed=true; }
-  if(server.hasArg("jitter")){ jitterStrengthPct = clampInt(server.arg("jitter").toInt(), 5, 45); changed=true; }
-  if(server.hasArg("think")){ thinkingSpaceChance = clampInt(server.arg("think").toInt(), 0, 100); changed=true; }
-  if(server.hasArg("typos")){ enableTypos = (server.arg("typos").toInt()!=0); changed=true; }
-  if(server.hasArg("lpen")){ enableLongPauses = (server.arg("lpen").toInt()!=0); changed=true; }
-  if(server.hasArg("lpc")){ longPausePercent = clampInt(server.arg("lpc").toInt(), 0, 100); changed=true; }
-  if(server.hasArg("lpmin")){ longPauseMinMs = clampInt(server.arg("lpmin").toInt(), 50, 20000); changed=true; }
-  if(server.hasArg("lpmax")){ longPauseMaxMs = clampInt(server.arg("lpmax").toInt(), 50, 30000); changed=true; }
-  if(server.hasArg("nl")){ newlineMode = clampInt(server.arg("nl").toInt(), 0, 2); changed=true; }
+  if(server.hasArg("wpm")){ c.wpm = clampInt(server.arg("wpm").toInt(), 10, 300); changed=true; }
+  if(server.hasArg("strict")){ c.strict = (server.arg("strict").toInt()!=0); changed=true; }
+  if(server.hasArg("jitter")){ c.jitterPct = clampInt(server.arg("jitter").toInt(), 5, 45); changed=true; }
+  if(server.hasArg("think")){ c.thinkChance = clampInt(server.arg("think").toInt(), 0, 100); changed=true; }
+  if(server.hasArg("typos")){ c.typos = (server.arg("typos").toInt()!=0); changed=true; }
+  if(server.hasArg("lpen")){ c.longPauses = (server.arg("lpen").toInt()!=0); changed=true; }
+  if(server.hasArg("lpc")){ c.longPausePct = clampInt(server.arg("lpc").toInt(), 0, 100); changed=true; }
+  if(server.hasArg("lpmin")){ c.longPauseMinMs = clampInt(server.arg("lpmin").toInt(), 50, 20000); changed=true; }
+  if(server.hasArg("lpmax")){ c.longPauseMaxMs = clampInt(server.arg("lpmax").toInt(), 50, 30000); changed=true; }
+  if(server.hasArg("nl")){ c.newlineMode = clampInt(server.arg("nl").toInt(), 0, 2); changed=true; }
 
   // code mode (single toggle)
-  if(server.hasArg("codemode")){ codeMode = (server.arg("codemode").toInt()!=0); changed=true; }
+  if(server.hasArg("codemode")){ c.codeMode = (server.arg("codemode").toInt()!=0); changed=true; }
 
-  if(longPauseMinMs > longPauseMaxMs){ int t = longPauseMinMs; longPauseMinMs = longPauseMaxMs; longPauseMaxMs = t; }
+  if(c.longPauseMinMs > c.longPauseMaxMs){ int t = c.longPauseMinMs; c.longPauseMinMs = c.longPauseMaxMs; c.longPauseMaxMs = t; }
+  if(changed) cfgPublish(c);
   server.send(changed?200:400, "text/plain", changed?"Config updated":"No changes");
 }
 
 void handleType(){
-  if(typingActive){ server.send(409, "text/plain", "Busy: already typing"); return; }
+  if(xEventGroupGetBits(typerEvents) & EVT_TYPING){ server.send(409, "text/plain", "Busy: already typing"); return; }
   String body = readRequestBody();
   if(body.length()==0){ server.send(400, "text/plain", "Empty body"); return; }
   if(!bleKeyboard.isConnected()){ server.send(503, "text/plain", "BLE not connected"); return; }
-  server.send(200, "text/plain", "Typing started (" + String(body.length()) + " chars)");
-  delay(10);
-  paused = false; // ensure not paused on new job
-  typeLikeHuman(body);
+  size_t n = body.length();
+  pendingBody = String(); pendingActive = false; // whatever a stopped job left unfed
+  textRingBegin(n);
+  // mark the job running before handing it over so a second /type can't slip in; new jobs start unpaused
+  xEventGroupClearBits(typerEvents, EVT_STOP);
+  xEventGroupSetBits(typerEvents, EVT_TYPING | EVT_RESUME);
+  uint32_t expected = n;
+  if(xQueueSend(jobQueue, &expected, 0) != pdTRUE){
+    xEventGroupClearBits(typerEvents, EVT_TYPING);
+    server.send(503, "text/plain", "Typer not ready");
+    return;
+  }
+  pendingBody = std::move(body); pendingActive = true; pendingPos = 0;
+  feedPending();
+  server.send(200, "text/plain", "Typing started (" + String(n) + " chars)");
 }
 
-void handleStop(){ typingActive = false; paused = false; server.send(200, "text/plain", "Stop requested"); }
+// GET /boot — esp_timer µs of each boot checkpoint (0 = not reached yet)
+void handleBoot(){
+  char buf[BOOT_JSON_MAX];
+  bootJson(buf, sizeof(buf));
+  server.send(200, "application/json", buf);
+}
+
+void handleStop(){ requestStop(); server.send(200, "text/plain", "Stop requested"); }
 
 // toggle pause/resume while typing
 void handlePause(){
-  if(!typingActive){ server.send(409, "text/plain", "Not typing"); return; }
-  paused = !paused;
-  server.send(200, "text/plain", paused?"Paused":"Resumed");
+  if(!typingActive()){ server.send(409, "text/plain", "Not typing"); return; }
+  setPaused(!isPaused());
+  server.send(200, "text/plain", isPaused()?"Paused":"Resumed");
 }
 
-// Setup / Loop
-void setup(){
-  Serial.begin(115200);
-  delay(100);
-  randomSeed(esp_random());
-  Serial.println("Starting BLE...");
-  bleKeyboard.begin();
-  delay(200);
+// Typer task (core 1): takes one job at a time from jobQueue and runs the typing engine on it
+void typerTask(void *arg){
+  for(;;){
+    uint32_t expected;
+    if(xQueueReceive(jobQueue, &expected, portMAX_DELAY) != pdTRUE) continue;
+    ulTaskNotifyTake(pdTRUE, 0); // drop wakeups left over from the previous job
+    powerHold(true);
+    typeLikeHuman<SketchFeatures>(expected);
+    powerHold(false);
+    xEventGroupClearBits(typerEvents, EVT_TYPING | EVT_STOP);
+    xEventGroupSetBits(typerEvents, EVT_RESUME); // clear paused state when finished
+  }
+}
 
-  Serial.println("Starting Wi-Fi AP...");
+// Server task (core 0): the only place handleClient() is called; tops textRing up from the pending body.
+// WebServer can only be polled: every tick while a job is fed, every SERVER_IDLE_POLL_MS while a station is
+// associated, and every SERVER_ALONE_POLL_MS when nobody is (no request can arrive), so an idle board can stay
+// asleep in between. A browser that just joined waits at most that long for its first page.
+#define SERVER_IDLE_POLL_MS 20
+#define SERVER_ALONE_POLL_MS 1000
+void serverTask(void *arg){
+  for(;;){
+    server.handleClient(); feedPending(); bleLinkPoll();
+    uint32_t ms = (typingActive() || WiFi.softAPgetStationNum()) ? SERVER_IDLE_POLL_MS : SERVER_ALONE_POLL_MS;
+    vTaskDelay(pendingActive ? 1 : pdMS_TO_TICKS(ms));
+  }
+}
+
+// Wi-Fi soft-AP and HTTP server, started by bootNetBegin() while setup() brings BLE up
+void netStart(){
   WiFi.mode(WIFI_AP);
   WiFi.softAP(AP_SSID, AP_PASS);
-  IPAddress ip = WiFi.softAPIP();
-  Serial.print("AP IP: "); Serial.println(ip);
+  bootMark(BOOT_AP);
+  server.begin();
+  xTaskCreatePinnedToCore(serverTask, "http", 6144, NULL, 2, &serverTaskHandle, SERVER_CORE);
+  bootMark(BOOT_HTTP);
+  Serial.println("Server ready. Open http://" + WiFi.softAPIP().toString());
+}
+
+// Setup / Loop
+void setup(){
+  bootMark(BOOT_SETUP);
+  Serial.begin(115200);
+  espEngineBegin(&espIo);
+  jobQueue = xQueueCreate(1, sizeof(uint32_t));
+  bootMark(BOOT_CONFIG); // nothing persisted here: the defaults are live
 
+  uiInit();
+  static const char *uiHeaders[] = {"If-None-Match"};
+  server.collectHeaders(uiHeaders, 1);
   server.on("/", HTTP_GET, handleRoot);
   server.on("/status", HTTP_GET, handleStatus);
   server.on("/config", HTTP_GET, handleConfig);
   server.on("/type", HTTP_POST, handleType);
   server.on("/stop", HTTP_GET, handleStop);
   server.on("/pause", HTTP_GET, handlePause); // pause/resume endpoint
+  server.on("/boot", HTTP_GET, handleBoot);    // boot checkpoint timings
 
-  server.begin();
-  Serial.println("Server ready. Open http://" + WiFi.softAPIP().toString());
-  Serial.println("Pair your target device to BLE name shown in console.");
+  xTaskCreatePinnedToCore(typerTask, "typer", 8192, NULL, 3, &typerTaskHandle, TYPER_CORE);
+
+  // the two radios come up in parallel: Wi-Fi + HTTP in bootNetBegin()'s task, BLE here
+  bootNetBegin(netStart);
+  bleKeyboard.begin();
+  bootMark(BOOT_BLE);
+  Serial.println("BLE advertising. Pair your target device to the BLE name shown in console.");
+  bootStepDone();
 }
 
-void loop(){ server.handleClient(); }
+// All work happens in typerTask/serverTask; free the Arduino loop task
+void loop(){ vTaskDelete(NULL); }
@@ -6,10 +6,38 @@
     * Multiple typo patterns (replace, transpose, duplicate, delete) and multi-char mistakes
     * Hold-time variation (key-down duration simulation) and per-session speed multiplier
     * Profiles / presets and nicer web UI with live typing preview animation
-    * Keystroke logging endpoint for analysis (optional)
+    * Keystroke logging endpoint for analysis (optional) — binary ring, /log streamed as JSON or raw
     * Play/Pause/Stop preserved and improved
     * Backspace-correction always erases exactly the mistaken chars
     * Minor protections (clamped ranges, safe defaults)
+    * Typing engine on its own FreeRTOS task (core 1), web server on core 0 — /type returns immediately
+    * Keystrokes scheduled on absolute µs deadlines (esp_timer), so strict WPM holds at 200–300 WPM
+    * Text is compiled into a keystroke plan (HID key/modifier + down/up µs) ahead of playback; /status has an approximate ETA
+    * High-throughput (turbo) paste: short BLE connection interval + up to 6 distinct keys per HID report
+    * /type body streams into a fixed ring buffer and is typed while it uploads (no full-text Strings)
+    * Web UI served pre-gzipped from flash (ui_pro.h, tools/gzip_ui.py) with ETag / 304; the raw page is compile-time only
+    * /type while busy queues the job (preallocated slots, lock-free hand-off); /queue lists, reorders, cancels
+    * Control plane on esp_http_server: per-URI callbacks, /type bodies throttled by TCP instead of blocking the server
+    * Live status pushed over Server-Sent Events (/events): rate-limited deltas, measured WPM
+    * Closed-loop pacing: PI drift control on measured send completion, pauses and upload waits excluded
+    * Engine config in one seqlocked struct; /config and /livewpm apply to a running job from its next word
+    * /bench plays generated text into a null HID sink: scheduling error percentiles, WPM, loop cost, stalls
+    * BLE and Wi-Fi brought up in parallel with no fixed delays; /boot reports boot checkpoint timestamps
+    * Config and up to 8 named profiles persisted in NVS (/profile), restored at boot before BLE/Wi-Fi
+    * Snippet cache: /type?save=1 keeps the filtered text (PSRAM if present), /type?snippet=<id> replays it
+    * Board-independent engine (engine.h) behind EngineIo; tools/host_sim.cpp runs it under a simulated clock
+    * One engine for all three sketches (engine_esp32.h), humanization layers chosen by a compile-time policy
+    * Prometheus-style /metrics: IKI and deadline-lateness histograms, typos, stalls, BLE drops, HTTP time, heap
+    * Compile-time host layouts (US, UK, US Dvorak): O(1) char -> HID lookup and physical-neighbour typos
+    * Optional digraph timing model: per-bigram IKI scale from a flash table (digraph.h, tools/digraph_table.py)
+    * Table-driven sampler (sampler.h): xoshiro128** + ziggurat normal + cached log-normal; /bench/rng times it
+    * /type?plan=1 replays a host-computed binary keystroke plan verbatim (tools/make_plan.py)
+    * Document store (/docs): large sources kept on LittleFS or in PSRAM, /type?file= streams them, &resume=1 continues
+    * No per-job heap: snippets live in one boot-time arena, handlers build replies in fixed buffers; /status has heapMin
+    * BLE drop mid-job: fast advertising to a bonded host, the job waits up to 30 s and resumes at the next key
+    * Power manager: idle at 40 MHz / light sleep between jobs and across long waits; /bench estimates mJ per 1000 chars
+    * Serial link (-DTYPIST_SERIAL_LINK=<baud>): framed jobs and control over UART / USB-CDC, Wi-Fi optional (-DTYPIST_NO_WIFI)
+    * Fleet mode (-DTYPIST_FLEET_KEY): boards find each other over ESP-NOW; /fleet aggregates them and fans out jobs, config, stop, pause
 
   Drop-in replacement for your original sketch — it keeps the same endpoints and behavior
   while adding many new config knobs and a modern UI.  I kept your original structure
@@ -17,59 +45,311 @@
 */
 
 #include <WiFi.h>
-#include <WebServer.h>
+#include <Preferences.h>
+#include <LittleFS.h>
+#include <esp_http_server.h>
 #include <BleKeyboard.h>
+#if defined(USE_NIMBLE)
+#include <NimBLEDevice.h>
+#else
+#include <BLEDevice.h>
+#include <esp_gap_ble_api.h>
+#endif
+#if defined(TYPIST_NO_WIFI) && !defined(TYPIST_SERIAL_LINK)
+#error "TYPIST_NO_WIFI needs TYPIST_SERIAL_LINK (nothing else could reach the board)"
+#endif
+#if defined(TYPIST_NO_WIFI) && defined(TYPIST_FLEET_KEY)
+#error "Fleet mode runs over Wi-Fi (ESP-NOW); drop TYPIST_NO_WIFI"
+#endif
+#if defined(TYPIST_FLEET_KEY)
+#include <esp_now.h>
+#include <esp_wifi.h>
+#include <mbedtls/md.h>
+#endif
 #include <ctype.h>
+#include <stdarg.h>
 #include <math.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/event_groups.h>
+#include <freertos/semphr.h>
+#include <esp_timer.h>
+#include "sampler.h"
+#include "engine.h"
 
 // BLE identity
 BleKeyboard bleKeyboard("Logitech K380", "Logitech", 100);
+#include "engine_esp32.h"
 
 // WiFi AP
 const char* AP_SSID = "ESP32_Control";
 const char* AP_PASS = "qwertyuiop120";
 
-WebServer server(80);
-
-// ---------------- Runtime config (defaults) ----------------
-volatile int configuredWPM = 100;
-volatile bool strictWPM = false;
-volatile int jitterStrengthPct = 12; // percent
-volatile int thinkingSpaceChance = 0;
-volatile int mistakePercent = 3;    // chance per-character to begin a mistake
-volatile bool enableTypos = true;
-volatile bool enableLongPauses = true;
-volatile int longPausePercent = 5;
-volatile int longPauseMinMs = 600;
-volatile int longPauseMaxMs = 1200;
-volatile int newlineMode = 1; // 0 keep,1 space,2 remove
-volatile bool extraPunctPause = true;
-
-// Code mode config (single toggle)
-volatile bool codeMode = false;    // OFF by default
-
-// New: Pro features
-volatile int typoMaxChars = 1;      // NEW: maximum characters in a single mistake (1..6)
-volatile int maxSimultaneousErrors = 1; // NEW: how many mistake chunks allowed concurrently (keeps small)
-volatile int holdMinMs = 18;        // NEW: simulated key hold min
-volatile int holdMaxMs = 100;       // NEW: simulated key hold max
-volatile float sessionSpeedMultiplier = 1.0f; // slight randomization per session
 volatile int profile = 0;           // selected profile (0 = custom)
-volatile bool enableKeystrokeLogging = false;
 
-// Runtime state
-volatile bool typingActive = false;
-volatile bool paused = false; // pause/resume state
-volatile unsigned long typedChars = 0;
+// ---------------- Profiles (NVS) ----------------
+// The live config and up to PROFILE_SLOTS named profiles are kept in NVS as small packed blobs ("cur", "p1".."p8")
+// and mirrored in RAM. setup() restores "cur" before BLE and Wi-Fi come up, so a power cycle needs no /config
+// round-trips. Loading a profile only touches RAM; NVS writes (they stall the flash cache on both cores) are
+// refused while typing, and the live config is persisted by statusTask once /config has been quiet for a while.
+#define PROFILE_SLOTS 8
+#define PROFILE_VERSION 2
+#define CFG_PERSIST_MS 3000    // quiet time after the last /config before "cur" is written
+#define PF_STRICT   0x01
+#define PF_TYPOS    0x02
+#define PF_LPAUSE   0x04
+#define PF_PUNCT    0x08
+#define PF_CODE     0x10
+#define PF_LOG      0x20
+#define PF_TURBO    0x40
+#define PF_DIGRAPH  0x80
+struct __attribute__((packed)) ProfileBlob {
+  uint8_t version;       // PROFILE_VERSION, 0 = empty
+  char name[16];
+  uint16_t wpm, longPauseMinMs, longPauseMaxMs, holdMinMs, holdMaxMs;
+  uint8_t jitterPct, thinkChance, mistakePct, longPausePct, newlineMode, typoMaxChars, maxErrors;
+  uint8_t flags;         // PF_*
+  uint8_t layout;        // LAYOUT_* (v2)
+};
+Preferences prefs;
+ProfileBlob profiles[PROFILE_SLOTS + 1];   // [0] = live config ("cur")
+volatile uint32_t cfgDirtyMs = 0;          // millis of the last unsaved /config change (0 = saved)
+
+static void profilePack(const EngineConfig &c, const char *name, ProfileBlob &b){
+  b = {};
+  b.version = PROFILE_VERSION;
+  strncpy(b.name, name, sizeof(b.name) - 1);
+  b.wpm = c.wpm; b.longPauseMinMs = c.longPauseMinMs; b.longPauseMaxMs = c.longPauseMaxMs;
+  b.holdMinMs = c.holdMinMs; b.holdMaxMs = c.holdMaxMs;
+  b.jitterPct = c.jitterPct; b.thinkChance = c.thinkChance; b.mistakePct = c.mistakePct; b.longPausePct = c.longPausePct;
+  b.newlineMode = c.newlineMode; b.typoMaxChars = c.typoMaxChars; b.maxErrors = c.maxErrors;
+  b.flags = (c.strict ? PF_STRICT : 0) | (c.typos ? PF_TYPOS : 0) | (c.longPauses ? PF_LPAUSE : 0) | (c.punctPause ? PF_PUNCT : 0) |
+            (c.codeMode ? PF_CODE : 0) | (c.logging ? PF_LOG : 0) | (c.turbo ? PF_TURBO : 0) |
+            (c.digraphs ? PF_DIGRAPH : 0);
+  b.layout = c.layout;
+}
+
+static void profileUnpack(const ProfileBlob &b, EngineConfig &c){
+  c.wpm = b.wpm; c.longPauseMinMs = b.longPauseMinMs; c.longPauseMaxMs = b.longPauseMaxMs;
+  c.holdMinMs = b.holdMinMs; c.holdMaxMs = b.holdMaxMs;
+  c.jitterPct = b.jitterPct; c.thinkChance = b.thinkChance; c.mistakePct = b.mistakePct; c.longPausePct = b.longPausePct;
+  c.newlineMode = b.newlineMode; c.typoMaxChars = b.typoMaxChars; c.maxErrors = b.maxErrors;
+  c.strict = b.flags & PF_STRICT; c.typos = b.flags & PF_TYPOS; c.longPauses = b.flags & PF_LPAUSE; c.punctPause = b.flags & PF_PUNCT;
+  c.codeMode = b.flags & PF_CODE; c.logging = b.flags & PF_LOG; c.turbo = b.flags & PF_TURBO;
+  c.digraphs = b.flags & PF_DIGRAPH;
+  c.layout = b.layout < LAYOUT_COUNT ? b.layout : 0;
+}
+
+static void profileKey(int slot, char *k){ if(slot == 0) strcpy(k, "cur"); else snprintf(k, 4, "p%d", slot); }
+
+// Boot: read every blob into the mirror and make "cur" the live config. A v1 blob (no layout byte) loads as US;
+// any other size or version is ignored.
+void profilesBegin(){
+  prefs.begin("typist", false);
+  for(int i=0;i<=PROFILE_SLOTS;i++){
+    char k[4]; profileKey(i, k);
+    ProfileBlob &b = profiles[i];
+    b = {};
+    size_t n = prefs.getBytes(k, &b, sizeof(b));
+    if(n == sizeof(b) - 1 && b.version == 1) b.version = PROFILE_VERSION;
+    else if(n != sizeof(b) || b.version != PROFILE_VERSION) b = {};
+  }
+  if(profiles[0].version){ EngineConfig c = cfgSnapshot(); profileUnpack(profiles[0], c); cfgPublish(c); }
+  uint8_t sel = prefs.getUChar("sel", 0);
+  profile = (sel <= PROFILE_SLOTS && profiles[sel].version) ? sel : 0;
+}
+
+// Write one slot's blob (skipped when NVS already holds the same bytes)
+static void profileWrite(int slot, const ProfileBlob &b){
+  char k[4]; profileKey(slot, k);
+  if(memcmp(&profiles[slot], &b, sizeof(b)) == 0) return;
+  profiles[slot] = b;
+  prefs.putBytes(k, &b, sizeof(b));
+}
+
+// statusTask: persist the live config and the selected profile once it has settled and nothing is typing
+void cfgPersistIfIdle(bool typing){
+  uint32_t d = cfgDirtyMs;
+  if(!d || typing || millis() - d < CFG_PERSIST_MS) return;
+  cfgDirtyMs = 0;
+  ProfileBlob b; profilePack(cfgSnapshot(), "", b);
+  profileWrite(0, b);
+  if(prefs.getUChar("sel", 0) != profile) prefs.putUChar("sel", (uint8_t)profile);
+}
+
+static inline void cfgChanged(){ cfgDirtyMs = millis() | 1; }
+
+
+// ---------------- Cross-core job handoff ----------------
+// The HTTP server and its helper tasks run on core 0 and typeLikeHuman runs on typerTask pinned to core 1.
+// /type hands a TypeJob to the typer through jobQueue and uploadTask streams the body into textRing (or, while the
+// typer is busy, into a jobPool slot that the typer takes next on its own). Run/stop/pause state
+// lives in engine_esp32.h's event group.
+QueueHandle_t jobQueue = NULL;        // TypeJob: streamed jobs and pool wake-ups
+
+struct TypeJob {
+  uint32_t expected;   // Content-Length of the body (0 = unknown)
+  uint32_t id;         // job number shown by /queue; 0 = wake-up only (a jobPool slot became ready)
+};
+
+// ---------------- Job queue ----------------
+// /type while the typer is busy stores the (already filtered) body in a preallocated slot instead of answering
+// 409. Slots move FREE -> FILLING (uploadTask) -> READY -> TAKEN (typer) -> FREE purely by atomic state changes:
+// the typer takes the READY slot with the lowest `order` the moment the previous job ends, /queue/move rewrites
+// `order` and /queue/cancel flips READY back to FREE. ringRefs guards textRing: a job may only (re)fill it after
+// a 0 -> n compare-exchange. A streamed /type takes 2 references (typer + uploadTask, so a stopped job's body
+// can drain without touching the next job's text); a slot started by the typer takes 1.
+#define JOB_POOL 4
+#define JOB_SLOT_SIZE 4096
+#define SLOT_FREE 0
+#define SLOT_FILLING 1
+#define SLOT_READY 2
+#define SLOT_TAKEN 3
+struct JobSlot {
+  uint8_t text[JOB_SLOT_SIZE];
+  uint32_t len, id;
+  bool code;                        // filter mode the body was stored with
+  bool plan;                        // raw keystroke plan, not text
+  std::atomic<uint32_t> order;      // READY slots run lowest first
+  std::atomic<uint8_t> state;
+};
+JobSlot jobPool[JOB_POOL];
+std::atomic<uint32_t> jobOrderNext(1);
+std::atomic<int> ringRefs(0);
+volatile uint32_t runningJobId = 0;
+
+static_assert(JOB_SLOT_SIZE <= TEXT_RING_SIZE, "a queued job is loaded into textRing in one go");
+
+static int poolCount(uint8_t st){ int n = 0; for(JobSlot &j : jobPool) if(j.state.load() == st) n++; return n; }
+
+static int poolAlloc(){
+  for(int i=0;i<JOB_POOL;i++){ uint8_t f = SLOT_FREE; if(jobPool[i].state.compare_exchange_strong(f, SLOT_FILLING)) return i; }
+  return -1;
+}
+
+// READY slot that runs next (lowest order), -1 if none
+static int poolPeek(){
+  int best = -1; uint32_t bestOrder = 0;
+  for(int i=0;i<JOB_POOL;i++){
+    if(jobPool[i].state.load(std::memory_order_acquire) != SLOT_READY) continue;
+    uint32_t o = jobPool[i].order.load();
+    if(best < 0 || o < bestOrder){ best = i; bestOrder = o; }
+  }
+  return best;
+}
+
+// Typer waits on a READY slot, so after filling one: give it its place in the run order and wake the typer
+static void poolCommit(JobSlot &js){
+  js.order.store(jobOrderNext++);
+  js.state.store(SLOT_READY, std::memory_order_release);
+  TypeJob wake = { 0, 0 }; xQueueSend(jobQueue, &wake, 0); // in case the typer went idle meanwhile
+}
+
+// ---------------- Snippet cache ----------------
+// Templates typed again and again are kept after filtering (newline / code mode applied), keyed by a hash of that
+// text: /type?save=1 stores the body as it uploads, /type?snippet=<id> loads it into textRing (or a queue slot)
+// with no body and no filtering — only timing, typos and pauses are planned afresh. All entries sit back to back in
+// one arena taken at boot (PSRAM when the board has it) and never freed, so the cache can't fragment the heap: a
+// save=1 upload filters its copy straight into the free tail (the job's staging area), snippetCommit() keeps it in
+// place or hands the tail back, and dropping an entry slides the later ones down. Least recently used entries make
+// room. Server task and uploadTask share the table.
+#define SNIPPET_MAX 16
+#define SNIPPET_MAX_LEN TEXT_RING_SIZE     // a replay is loaded into textRing in one go
+#define SNIPPET_BUDGET_PSRAM (512 * 1024)
+#define SNIPPET_BUDGET_HEAP (24 * 1024)
+struct Snippet {
+  uint32_t id;          // snippetHash() of the text, 0 = empty entry
+  uint32_t len;         // chars, also the bytes it occupies in the arena
+  uint32_t uses, lastUse;
+  bool code;            // filter mode the text was stored with
+  uint8_t *text;        // into snippetArena
+};
+Snippet snippets[SNIPPET_MAX];
+SemaphoreHandle_t snippetLock = NULL;
+static uint32_t snippetClock = 0;
+static uint8_t *snippetArena = NULL;
+static size_t snippetArenaSize = 0;
+static size_t snippetBytes = 0;       // committed text, packed from the start of the arena
+static bool snippetStaging = false;   // an upload is writing past snippetBytes
+
+// Once from setup(): the whole budget in one block, before anything else can fragment the heap
+void snippetsBegin(){
+  snippetLock = xSemaphoreCreateMutex();
+  if(psramFound() && (snippetArena = (uint8_t*)ps_malloc(SNIPPET_BUDGET_PSRAM))) snippetArenaSize = SNIPPET_BUDGET_PSRAM;
+  else if((snippetArena = (uint8_t*)malloc(SNIPPET_BUDGET_HEAP))) snippetArenaSize = SNIPPET_BUDGET_HEAP;
+}
 
-// Simple in-memory keystroke log (circular buffer)
+// FNV-1a over the mode byte and the filtered text
+static uint32_t snippetHash(const uint8_t *t, uint32_t n, bool code){
+  uint32_t h = (2166136261u ^ (code ? 1u : 0u)) * 16777619u;
+  for(uint32_t i=0;i<n;i++){ h ^= t[i]; h *= 16777619u; }
+  return h ? h : 1;
+}
+
+// Caller holds snippetLock; snippetDrop() moves other entries' text, so never while staging
+static Snippet *snippetFind(uint32_t id){ for(Snippet &e : snippets) if(e.id && e.id == id) return &e; return NULL; }
+static void snippetDrop(Snippet &e){
+  uint8_t *after = e.text + e.len;
+  memmove(e.text, after, snippetArena + snippetBytes - after);
+  for(Snippet &x : snippets) if(x.id && x.text > e.text) x.text -= e.len;
+  snippetBytes -= e.len; e = {};
+}
+
+// Reserve the free tail for an upload's filtered copy (n = body length, filtering only shrinks it), evicting LRU
+// entries until it fits and an entry is free. NULL if n is larger than the arena.
+uint8_t *snippetStage(size_t n){
+  uint8_t *p = NULL;
+  xSemaphoreTake(snippetLock, portMAX_DELAY);
+  if(!snippetStaging && n <= snippetArenaSize){
+    for(;;){
+      Snippet *empty = NULL, *lru = NULL;
+      for(Snippet &x : snippets){
+        if(!x.id){ if(!empty) empty = &x; }
+        else if(!lru || x.lastUse < lru->lastUse) lru = &x;
+      }
+      if(empty && snippetBytes + n <= snippetArenaSize) break;
+      snippetDrop(*lru);
+    }
+    snippetStaging = true;
+    p = snippetArena + snippetBytes;
+  }
+  xSemaphoreGive(snippetLock);
+  return p;
+}
+
+// Keep the staged copy (len chars) as a snippet, or just release the tail (len 0). Returns the id, 0 if none.
+uint32_t snippetCommit(uint32_t len, bool code){
+  xSemaphoreTake(snippetLock, portMAX_DELAY);
+  uint8_t *text = snippetArena + snippetBytes;
+  uint32_t id = len ? snippetHash(text, len, code) : 0;
+  if(id && !snippetFind(id)){
+    for(Snippet &e : snippets) if(!e.id){ e = { id, len, 0, ++snippetClock, code, text }; break; } // staging kept one free
+    snippetBytes += len;
+  }
+  snippetStaging = false;
+  xSemaphoreGive(snippetLock);
+  return id;
+}
+
+// ---------------- Keystroke log ----------------
+// Fixed POD ring written by the player right after each key-up: no String and no heap on the hot path, so
+// logging can stay on in production without moving keystrokes. /log streams it as chunked JSON (or the raw
+// entries with ?format=bin). The writer bumps logSeq after filling a slot; readers drop slots it has lapped.
 #define MAX_LOG_ENTRIES 1024
-String keystrokeLog[MAX_LOG_ENTRIES];
-volatile int logHead = 0; // next insert
-volatile int logCount = 0;
+struct __attribute__((packed)) LogEntry {
+  uint32_t tUs;       // key-down time (esp_timer µs, low 32 bits)
+  uint32_t delayUs;   // since the previous key-down
+  uint32_t holdUs;    // key-down to key-up
+  uint8_t type;       // LOG_*
+  char ch;
+};
+LogEntry keystrokeLog[MAX_LOG_ENTRIES];
+std::atomic<uint32_t> logSeq(0);  // entries ever written; entry n lives in slot n % MAX_LOG_ENTRIES
 
 // ---------------- HTML UI (enhanced) ----------------
-const char INDEX_HTML[] PROGMEM = R"rawliteral(
+constexpr char INDEX_HTML[] PROGMEM = R"rawliteral(
 <!doctype html>
 <html lang="en"><head><meta charset="utf-8"/><meta name="viewport" content="width=device-width,initial-scale=1"/>
 <title>ESP32 BLE Typist — Pro</title>
@@ -122,6 +402,7 @@ textarea{min-height:200px;font-family:ui-monospace,Consolas,monospace;white-spac
     <div class="row">
       <div class="preview" id="preview"> <span id="previewText"></span><span class="cursor" id="cursor"></span></div>
       <div style="height:10px;margin-top:8px" class="progress"><div id="progressBar"></div></div>
+      <div class="small" id="live" style="margin-top:6px">Connecting…</div>
     </div>
 
     <div class="row"><div class="small">Preview: your browser will animate the text locally to give an idea of how the ESP will type using the chosen settings. The device may differ slightly due to BLE latency.</div></div>
@@ -160,17 +441,51 @@ textarea{min-height:200px;font-family:ui-monospace,Consolas,monospace;white-spac
       <select id="typos"><option value="1">Yes</option><option value="0">No</option></select>
     </div>
 
+    <div class="row">
+      <label>High-throughput paste (no humanization, 6 keys per report)</label>
+      <select id="turbo"><option value="0">Off</option><option value="1">On</option></select>
+    </div>
+
     <div class="row">
       <label>Newline handling</label>
       <select id="nl"><option value="0">Keep Enter</option><option value="1" selected>Replace with space</option><option value="2">Remove</option></select>
     </div>
 
+    <div class="row">
+      <label>Host keyboard layout</label>
+      <select id="layout"><option value="0">US</option><option value="1">UK</option><option value="2">US Dvorak</option></select>
+    </div>
+
+    <div class="row">
+      <label>Timing model</label>
+      <select id="digraph"><option value="0">Flat (per-char)</option><option value="1">Digraph (per-bigram latency)</option></select>
+    </div>
+
     <hr style="border-color:#172027" />
     <h3>Presets</h3>
     <div class="row controls">
       <button class="preset" onclick="applyPreset(1)">Human - Slow</button>
       <button class="preset" onclick="applyPreset(2)">Human - Fast</button>
       <button class="preset" onclick="applyPreset(3)">Bot - Flat</button>
+      <button class="preset" onclick="applyPreset(4)">Human - Digraph</button>
+    </div>
+
+    <h3>Device profiles</h3>
+    <div class="row controls">
+      <select id="prof" style="width:auto"></select>
+      <button class="ghost" onclick="loadProfile()">Load</button>
+      <button class="ghost" onclick="deleteProfile()">Delete</button>
+    </div>
+
+    <div id="fleet" style="display:none">
+      <h3>Fleet</h3>
+      <div class="row controls">
+        <button class="ghost" onclick="fleetType('all')">Type on all</button>
+        <button class="ghost" onclick="fleetType('next')">Type on next idle</button>
+        <button class="ghost" onclick="fleetCmd('config')">Push settings</button>
+        <button class="ghost" onclick="fleetCmd('stop')">Stop all</button>
+      </div>
+      <div class="small" id="fleetList"></div>
     </div>
 
     <div class="row footer">Pro tip: use "Bot - Flat" to generate detectible signatures for testing detectors. Use the Human presets for more realism.</div>
@@ -188,7 +503,10 @@ async function applyConfig(){
     typos: document.getElementById('typos').value,
     typoMax: document.getElementById('typoMax').value,
     mistake: document.getElementById('mistake').value,
-    nl: document.getElementById('nl').value
+    nl: document.getElementById('nl').value,
+    layout: document.getElementById('layout').value,
+    digraph: document.getElementById('digraph').value,
+    turbo: document.getElementById('turbo').value
   });
   const r = await fetch('/config?' + p.toString());
   const t = await r.text();
@@ -230,13 +548,17 @@ async function getStatus(){
     document.getElementById('typoMax').value=j.typoMax?j.typoMax:1;
     document.getElementById('mistake').value=j.mistake?j.mistake:3;
     document.getElementById('nl').value=j.nl;
+    document.getElementById('layout').value=j.layout;
+    document.getElementById('digraph').value = j.digraph?1:0;
+    document.getElementById('turbo').value = j.turbo?1:0;
   }catch(e){ console.error(e); }
 }
 
 function applyPreset(id){
   if(id==1){ document.getElementById('wpm').value=70; document.getElementById('jitter').value=18; document.getElementById('typoMax').value=1; document.getElementById('mistake').value=6; document.getElementById('typos').value=1; }
   if(id==2){ document.getElementById('wpm').value=120; document.getElementById('jitter').value=10; document.getElementById('typoMax').value=1; document.getElementById('mistake').value=2; document.getElementById('typos').value=1; }
-  if(id==3){ document.getElementById('wpm').value=110; document.getElementById('jitter').value=2; document.getElementById('typoMax').value=1; document.getElementById('mistake').value=0; document.getElementById('typos').value=0; }
+  if(id==3){ document.getElementById('wpm').value=110; document.getElementById('jitter').value=2; document.getElementById('typoMax').value=1; document.getElementById('mistake').value=0; document.getElementById('typos').value=0; document.getElementById('digraph').value=0; }
+  if(id==4){ document.getElementById('wpm').value=90; document.getElementById('jitter').value=12; document.getElementById('typoMax').value=1; document.getElementById('mistake').value=3; document.getElementById('typos').value=1; document.getElementById('digraph').value=1; }
   applyConfig();
 }
 
@@ -303,469 +625,2131 @@ function startPreview(text){
   previewTimer = setInterval(step, Math.max(8, Math.floor(meanMs/2)));
 }
 
-function savePreset(){ alert('Preset saved locally (not implemented). You can extend this UI to store presets on the device or in browser localStorage.'); }
+// Device profiles (NVS): Save preset stores the current settings in the selected slot
+async function listProfiles(){
+  try{
+    const j = await (await fetch('/profile')).json();
+    const names = {}; j.profiles.forEach(p => names[p.id] = p.name);
+    const sel = document.getElementById('prof');
+    sel.innerHTML = '';
+    for(let i=1;i<=8;i++){ const o = document.createElement('option'); o.value = i; o.textContent = i + ' · ' + (names[i] || '(empty)'); sel.appendChild(o); }
+    if(j.active) sel.value = j.active;
+  }catch(e){ console.error(e); }
+}
+async function savePreset(){
+  const id = document.getElementById('prof').value;
+  const name = prompt('Profile name', 'Profile ' + id);
+  if(name === null) return;
+  await applyConfig();
+  const r = await fetch('/profile/save?id=' + id + '&name=' + encodeURIComponent(name));
+  console.log(await r.text());
+  listProfiles();
+}
+async function loadProfile(){
+  const r = await fetch('/profile/load?id=' + document.getElementById('prof').value);
+  console.log(await r.text());
+  getStatus();
+}
+async function deleteProfile(){
+  const r = await fetch('/profile/delete?id=' + document.getElementById('prof').value);
+  console.log(await r.text());
+  listProfiles();
+}
+
+// Live device status pushed over /events; each message carries only the fields that changed
+const live = {t:0,s:0,w:0,e:0,n:0,b:0,q:0};
+function startLive(){
+  const es = new EventSource('/events');
+  es.onmessage = ev => {
+    Object.assign(live, JSON.parse(ev.data));
+    const st = ['Ready','Typing','Paused'][live.s] || '';
+    document.getElementById('live').textContent = (live.b?'BLE connected':'BLE not connected') + ' · ' + st + ' · ' +
+      live.t + (live.n?'/'+live.n:'') + ' chars · ' + live.w + ' WPM' + (live.e?' · ETA '+Math.ceil(live.e/1000)+'s':'') +
+      (live.q?' · '+live.q+' queued':'');
+  };
+}
+
+// Fleet mode (built with TYPIST_FLEET_KEY): the section stays hidden when /fleet isn't there
+async function refreshFleet(){
+  try{
+    const r = await fetch('/fleet');
+    if(!r.ok) return;
+    const j = await r.json();
+    document.getElementById('fleet').style.display = '';
+    document.getElementById('fleetList').innerHTML = j.workers.length ? j.workers.map(w =>
+      w.mac + ' · ' + (w.ble?'BLE':'no BLE') + ' · ' + (w.paused?'Paused':w.typing?'Typing '+w.typed+(w.chars?'/'+w.chars:'')+' @ '+w.mwpm+' WPM':'Idle') +
+      (w.queued?' · '+w.queued+' queued':'')).join('<br>') + '<br>' + j.typing + ' typing · ' + j.mwpm + ' WPM total' : 'No workers in range';
+    setTimeout(refreshFleet, 2000);
+  }catch(e){}
+}
+async function fleetType(to){
+  await applyConfig();
+  await fleetCmd('config');
+  const data = document.getElementById('text').value;
+  if(!data || data.trim()===''){ alert('Nothing to send'); return; }
+  const r = await fetch('/fleet/type?to=' + to, {method:'POST', headers:{'Content-Type':'text/plain'}, body:data});
+  console.log(await r.text());
+  refreshFleet();
+}
+async function fleetCmd(c){
+  const r = await fetch('/fleet/' + c);
+  console.log(await r.text());
+}
 
-getStatus();
+getStatus().then(listProfiles).then(startLive).then(refreshFleet);
 </script>
 </body></html>
 )rawliteral";
+#include "ui_pro.h"
+
+// ---------------- BLE connection interval ----------------
+// Turbo mode asks the host for the shortest HID connection interval (7.5–15 ms) so each report pair goes out on
+// the next connection event; idle/human typing goes back to a relaxed 30–50 ms. The host has the final say.
+
+#if !defined(USE_NIMBLE)
+esp_bd_addr_t blePeer;
+volatile bool blePeerKnown = false;
+#endif
+
+void requestConnInterval(bool fast){
+  uint16_t minInt = fast ? 6 : 24, maxInt = fast ? 12 : 40; // 1.25 ms units
+#if defined(USE_NIMBLE)
+  NimBLEServer *srv = NimBLEDevice::getServer();
+  if(!srv) return;
+  for(uint16_t h : srv->getPeerDevices()) srv->updateConnParams(h, minInt, maxInt, 0, 400);
+#else
+  if(!blePeerKnown) return;
+  esp_ble_conn_update_params_t cp = {};
+  memcpy(cp.bda, blePeer, sizeof(esp_bd_addr_t));
+  cp.min_int = minInt; cp.max_int = maxInt; cp.latency = 0; cp.timeout = 400; // 4 s supervision timeout
+  esp_ble_gap_update_conn_params(&cp);
+#endif
+}
 
-// Utilities
-String readRequestBody(){ if(server.hasArg("plain")) return server.arg("plain"); return String(); }
-int clampInt(int v,int a,int b){ if(v<a) return a; if(v>b) return b; return v; }
-static inline float ms_per_char_for_wpm(int wpm){ if(wpm<1) wpm=1; return 60000.0f / (wpm * 5.0f); }
-
-// New: Gaussian random using Box-Muller (returns standard normal)
-static float gaussian_rand(){
-  // random() returns long, use number in (0,1]
-  float u1 = (random(1, 10001) / 10000.0f);
-  float u2 = (random(1, 10001) / 10000.0f);
-  return sqrtf(-2.0f * logf(u1)) * cosf(2.0f * PI * u2);
-}
-
-// Log-normal sample with mean_ms and sigma
-static float lognormal_sample_ms(float mean_ms, float sigma){
-  // convert mean to mu for log-normal: mean = exp(mu + sigma^2/2)
-  float mu = logf(mean_ms) - 0.5f * sigma * sigma;
-  float z = gaussian_rand();
-  float val = expf(mu + sigma * z);
-  if(val < 3.0f) val = 3.0f;
-  return val;
-}
-
-// Cooperative delay that allows STOP + HTTP handling during waits
-void coopDelay(unsigned long ms){
-  unsigned long start = millis();
-  while(typingActive && (millis() - start < ms)){
-    server.handleClient();
-    // If paused, remain responsive to HTTP but don't advance time-based waits
-    while(paused && typingActive){
-      server.handleClient();
-      delay(1);
-      yield();
-    }
-    delay(1);
-    yield();
+#if !defined(USE_NIMBLE)
+// Remember the peer address so connection parameters can be renegotiated later
+void bleGattsHook(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param){
+  if(event == ESP_GATTS_CONNECT_EVT){
+    memcpy(blePeer, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+    blePeerKnown = true;
+    bootMark(BOOT_BLE_CONNECTED);
+    if(cfgSnapshot().turbo) requestConnInterval(true);
+  } else if(event == ESP_GATTS_DISCONNECT_EVT){
+    blePeerKnown = false;
   }
 }
+#endif
+
+// Keystroke log helpers (writer: typer task only)
+static inline void logKeystroke(uint8_t type, char ch, int64_t tUs, uint32_t delayUs, uint32_t holdUs){
+  uint32_t n = logSeq.load(std::memory_order_relaxed);
+  LogEntry &e = keystrokeLog[n % MAX_LOG_ENTRIES];
+  e.tUs = (uint32_t)tUs; e.delayUs = delayUs; e.holdUs = holdUs; e.type = type; e.ch = ch;
+  logSeq.store(n + 1, std::memory_order_release);
+}
 
-void sendChar(char c){
-  // simple mapping: print char
-  bleKeyboard.print(c);
+// Copy entry n; false if the writer has lapped it (or may be rewriting its slot right now)
+bool logRead(uint32_t n, LogEntry &out){
+  out = keystrokeLog[n % MAX_LOG_ENTRIES];
+  return logSeq.load(std::memory_order_acquire) - n < MAX_LOG_ENTRIES;
+}
+
+// ---------------- Engine I/O (ESP32) ----------------
+// engine_esp32.h's EspIo plus what only this sketch has: turbo connection interval and the keystroke log.
+struct ProIo : EspIo {
+  void turbo(bool on) override { requestConnInterval(on); }
+  void logKey(uint8_t type, char ch, int64_t tUs, uint32_t ikiUs, uint32_t holdUs) override { logKeystroke(type, ch, tUs, ikiUs, holdUs); }
+};
+// /bench plays real plans into a null sink: same player and clock, no radio
+struct NullSinkIo : EspIo {
+  bool hidReady() override { return true; }
+  void hidSend(const HidReport &h) override {}
+};
+ProIo espIo;
+NullSinkIo nullSinkIo;
+
+// ---------------- Engine bench ----------------
+// /bench?run=1 makes the typer play generated text into the null HID sink for every WPM x code-mode pair and
+// records, per row, the key-down scheduling error (p50/p99/max), achieved WPM, player cost per report and stalls.
+// Plans use a fixed seed and the live config apart from WPM and code mode, so builds can be compared directly.
+// Energy per 1000 chars is estimated from the measured time the typer spent holding the power locks (full speed)
+// and not (idle at POWER_MIN_MHZ, or light sleep if enabled) with the datasheet's chip currents below; radio
+// current is the same either way and left out. Put a meter's figures in POWER_*_MA for a board-level number.
+#define POWER_BUSY_MA 68.0f        // 240 MHz, both cores, radios idle
+#define POWER_DFS_MA 12.0f         // 40 MHz
+#define POWER_SLEEP_MA 0.8f        // light sleep
+#define POWER_VOLTS 3.3f
+#define BENCH_JOB_ID 0xffffffffu   // TypeJob id that runs benchRun() instead of a text job
+#define BENCH_MAX_ROWS 12
+struct BenchRow {
+  uint16_t wpm, wpmAchieved;
+  bool code;
+  uint32_t chars, p50, p99, errMax, stalls, costAvg, costMax;
+  uint16_t awakePermille;     // time at full speed
+  float mJ1k;                 // estimated energy per 1000 chars
+};
+struct BenchState {
+  std::atomic<uint8_t> state;      // 0 never run, 1 running, 2 finished (or stopped)
+  uint16_t wpm[BENCH_MAX_ROWS]; bool code[BENCH_MAX_ROWS];
+  uint32_t chars;
+  uint8_t rows, done;
+  BenchRow row[BENCH_MAX_ROWS];
+  uint32_t heapFree, heapMin, stackFree;
+};
+BenchState bench;
+
+// Fill textRing with about n chars of prose or indented code, filtered like an upload
+static uint32_t benchText(uint32_t n, bool code){
+  static const char *const WORDS[] = { "the", "quick", "brown", "fox", "jumps", "over", "a", "lazy", "dog,", "while", "typing",
+    "engine", "keeps", "steady", "time.", "Every", "keystroke", "is", "planned", "ahead", "and", "played", "on", "schedule." };
+  static const char *const LINES[] = { "int main(void) {\n", "    for (int i = 0; i < n; i++) {\n", "        sum += a[i] * 2;\n",
+    "    }\n", "    if (sum > 100) return -1;\n", "    return 0;\n", "}\n", "// done\n" };
+  FastRng r; r.seed(BENCH_SEED);
+  TextTransform t; t.begin(code, 1);
+  uint32_t k = 0;
+  if(n > TEXT_RING_SIZE) n = TEXT_RING_SIZE;
+  while(k < n){
+    const char *w = code ? LINES[r.range(0, 8)] : WORDS[r.range(0, 24)];
+    const uint8_t *in = (const uint8_t*)w, *end = in + strlen(w); char c;
+    while(k < n && t.next(in, end, c)) textRing.buf[k++] = (uint8_t)c;
+    if(!code && k < n) textRing.buf[k++] = ' ';
+  }
+  textRing.rd.store(0); textRing.wr.store(k);
+  textRing.expected = k; textRing.code = code; textRing.plan = false;
+  textRing.eof.store(true, std::memory_order_release);
+  return k;
+}
+
+// Typer task, holding textRing: run every row unless /stop
+void benchRun(){
+  EngineConfig c = cfgSnapshot();
+  c.turbo = false; c.logging = false;
+  engineIo = &nullSinkIo;
+  bench.heapFree = ESP.getFreeHeap();
+  for(uint8_t i=0;i<bench.rows && typingActive();i++){
+    c.wpm = bench.wpm[i]; c.codeMode = bench.code[i];
+    uint32_t n = benchText(bench.chars, c.codeMode);
+    memset(&probe, 0, sizeof(probe));
+    probe.on = true;
+    powerTally();
+    int64_t busy0 = powerBusyUs, idle0 = powerIdleUs;
+    typeLikeHuman<FeaturesPro>(n, &c);
+    powerTally();
+    probe.on = false;
+    BenchRow &b = bench.row[i];
+    float busyS = (powerBusyUs - busy0) / 1e6f, idleS = (powerIdleUs - idle0) / 1e6f;
+    float idleMa = powerMode == POWER_LIGHT_SLEEP ? POWER_SLEEP_MA : powerMode == POWER_DFS ? POWER_DFS_MA : POWER_BUSY_MA;
+    b.awakePermille = busyS + idleS > 0 ? (uint16_t)(1000 * busyS / (busyS + idleS)) : 1000;
+    b.mJ1k = typedChars ? POWER_VOLTS * (busyS * POWER_BUSY_MA + idleS * idleMa) * 1000.0f / typedChars : 0;
+    b.wpm = c.wpm; b.code = c.codeMode; b.chars = typedChars; b.wpmAchieved = measuredWpm;
+    b.p50 = probePercentile(0.50f); b.p99 = probePercentile(0.99f); b.errMax = probe.errMax; b.stalls = probe.stalls;
+    b.costAvg = probe.n ? (uint32_t)(probe.costSum / probe.n) : 0; b.costMax = probe.costMax;
+    bench.done = i + 1;
+  }
+  bench.heapMin = ESP.getMinFreeHeap();
+  bench.stackFree = uxTaskGetStackHighWaterMark(NULL); // bytes on ESP32
+  engineIo = &espIo;
+  bench.state.store(2);
+}
+
+// ---------------- HTTP control plane ----------------
+// esp_http_server (ships with the core, no extra library) runs its own select() loop on core 0 and calls
+// one handler per URI, so /stop and /pause are served while a /type body is still uploading. Requests that
+// outlive their handler are detached with httpd_req_async_handler_begin() (ESP-IDF 5.1+, i.e. Arduino core 3.x):
+//   * /type bodies are read by uploadTask, which blocks while textRing is full — the TCP window closes and
+//     throttles the sender, while the server keeps handling every other socket
+//   * /events listeners are held by statusTask, which pushes SSE frames on a timer
+// Socket timeouts are short, so a slow or stalled client only ever holds its own socket; nothing here runs
+// on the typer's core.
+httpd_handle_t httpServer = NULL;
+QueueHandle_t uploadQueue = NULL;      // detached /type requests (httpd_req_t*)
+QueueHandle_t sseJoinQueue = NULL;     // detached /events requests waiting for a listener slot
+TaskHandle_t uploadTaskHandle = NULL;
+TaskHandle_t statusTaskHandle = NULL;
+std::atomic<bool> uploadBusy(false);   // a /type body is being read (set by the server, cleared by uploadTask)
+
+static const char *httpStatusLine(int code){
+  switch(code){
+    case 200: return "200 OK";
+    case 304: return "304 Not Modified";
+    case 400: return "400 Bad Request";
+    case 404: return "404 Not Found";
+    case 409: return "409 Conflict";
+    case 413: return "413 Payload Too Large";
+    case 503: return "503 Service Unavailable";
+    default:  return "500 Internal Server Error";
+  }
 }
-void sendBackspace(){ bleKeyboard.write(KEY_BACKSPACE); }
 
-// Keystroke log helper
-void logKeystroke(const String &s){
-  if(!enableKeystrokeLogging) return;
-  keystrokeLog[logHead] = s;
-  logHead = (logHead + 1) % MAX_LOG_ENTRIES;
-  if(logCount < MAX_LOG_ENTRIES) logCount++;
+// Same shape as WebServer::send(): status, content type (NULL keeps the default), body
+static esp_err_t reply(httpd_req_t *req, int code, const char *type, const char *body, ssize_t len = HTTPD_RESP_USE_STRLEN){
+  httpd_resp_set_status(req, httpStatusLine(code));
+  if(type) httpd_resp_set_type(req, type);
+  return httpd_resp_send(req, body, len);
 }
 
-// Preprocess newline handling (non-code mode)
-String preprocessText(const String &in){
-  if(newlineMode==0) return in;
-  String out; out.reserve(in.length());
-  for(size_t i=0;i<in.length();++i){
-    char c = in[i];
-    if(c == '\r' || c == '\n'){
-      if(newlineMode == 1) out += ' ';
-      // if mode 2 => drop entirely
-    } else {
-      out += c;
+// Request header into buf (a truncated value still counts: callers only compare short tokens)
+static bool reqHeader(httpd_req_t *req, const char *name, char *buf, size_t n){
+  esp_err_t e = httpd_req_get_hdr_value_str(req, name, buf, n);
+  return e == ESP_OK || e == ESP_ERR_HTTPD_RESULT_TRUNC;
+}
+
+// Query string of one request. Every knob is a short number or flag, so values need no URL-decoding.
+struct QueryArgs {
+  char q[256];
+  explicit QueryArgs(httpd_req_t *req){ if(httpd_req_get_url_query_str(req, q, sizeof(q)) != ESP_OK) q[0] = 0; }
+  QueryArgs(const char *s, size_t n){ n = std::min(n, sizeof(q) - 1); memcpy(q, s, n); q[n] = 0; } // serial link
+  bool has(const char *k) const { char v[16]; esp_err_t e = httpd_query_key_value(q, k, v, sizeof(v)); return e == ESP_OK || e == ESP_ERR_HTTPD_RESULT_TRUNC; }
+  long toInt(const char *k) const { char v[16]; return httpd_query_key_value(q, k, v, sizeof(v)) == ESP_OK ? atol(v) : 0; }
+  bool equals(const char *k, const char *want) const { char v[16]; return httpd_query_key_value(q, k, v, sizeof(v)) == ESP_OK && strcmp(v, want) == 0; }
+  // Short free-text value (profile names): %XX and '+' decoded, anything but printable ASCII dropped
+  bool text(const char *k, char *out, size_t n) const {
+    char v[48]; esp_err_t e = httpd_query_key_value(q, k, v, sizeof(v));
+    if(e != ESP_OK && e != ESP_ERR_HTTPD_RESULT_TRUNC) return false;
+    size_t o = 0;
+    for(const char *p = v; *p && o + 1 < n; p++){
+      char c = *p;
+      if(c == '+') c = ' ';
+      else if(c == '%' && isxdigit((unsigned char)p[1]) && isxdigit((unsigned char)p[2])){ char h[3] = { p[1], p[2], 0 }; c = (char)strtol(h, NULL, 16); p += 2; }
+      if(c >= 32 && c < 127 && c != '"' && c != '\\') out[o++] = c;
     }
+    out[o] = 0;
+    return true;
   }
-  return out;
+  uint32_t toHex(const char *k) const { char v[16]; return httpd_query_key_value(q, k, v, sizeof(v)) == ESP_OK ? (uint32_t)strtoul(v, NULL, 16) : 0; }
+};
+
+// HTTP Handlers
+// Web UI: pre-gzipped copy of INDEX_HTML from flash (tools/gzip_ui.py) with an ETag, so repeat loads are a bodyless 304.
+// The raw page is only hashed at compile time and never linked, unless built with -DTYPIST_UI_DEV (serves it as is,
+// for editing the UI without re-running the script). A ui_*.h left stale by a UI edit fails the build.
+static constexpr uint32_t fnv1a(const char *s){ uint32_t h = 2166136261u; while(*s){ h ^= (uint8_t)*s++; h *= 16777619u; } return h; }
+static constexpr uint32_t UI_HASH = fnv1a(INDEX_HTML);
+#ifndef TYPIST_UI_DEV
+static_assert(UI_HASH == INDEX_HTML_HASH, "web UI changed since tools/gzip_ui.py last ran: re-run it (or build with -DTYPIST_UI_DEV)");
+#endif
+static char uiEtag[16];
+void uiInit(){
+  snprintf(uiEtag, sizeof(uiEtag), "\"%08x\"", (unsigned)UI_HASH);
+}
+esp_err_t handleRoot(httpd_req_t *req){
+  char h[64];
+  httpd_resp_set_hdr(req, "Cache-Control", "no-cache"); // always revalidate, so a reflashed UI shows up at once
+  httpd_resp_set_hdr(req, "ETag", uiEtag);
+  if(reqHeader(req, "If-None-Match", h, sizeof(h)) && strcmp(h, uiEtag) == 0) return reply(req, 304, NULL, NULL, 0);
+#ifdef TYPIST_UI_DEV
+  return reply(req, 200, "text/html", INDEX_HTML);
+#else
+  httpd_resp_set_hdr(req, "Content-Encoding", "gzip"); // the only copy in flash; every browser accepts it
+  return reply(req, 200, "text/html", (const char*)INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ));
+#endif
 }
 
-// Small helper to cap jitter at very high WPM
-static inline float capJitterForWPM(int wpm, float jpct){ if(wpm >= 140 && jpct > 0.08f) return 0.08f; return jpct; }
+// One fixed buffer instead of a String built per poll (handlers run one at a time on the httpd task)
+static char statusBuf[768];
+#define JB(v) ((v) ? "true" : "false")
+static void statusJson(char *buf, size_t n){
+  EngineConfig c = cfgSnapshot();
+  bool on = typingActive();
+  // eta: ms left by the dry-run plan; approximate (drift correction and word-boundary config reloads move it)
+  long eta = on ? (long)(jobEndMs - (uint32_t)(esp_timer_get_time() / 1000)) : 0;
+  snprintf(buf, n,
+    "{\"ble\":%s,\"wpm\":%d,\"mwpm\":%u,\"strict\":%s,\"jitter\":%d,\"think\":%d,\"typos\":%s,\"lpen\":%s,"
+    "\"lpmn\":%d,\"lpmx\":%d,\"lpp\":%d,\"nl\":%d,\"codemode\":%s,\"layout\":%d,\"digraph\":%s,\"typed\":%lu,"
+    "\"running\":%s,\"paused\":%s,\"typoMax\":%d,\"mistake\":%d,\"holdMin\":%d,\"holdMax\":%d,\"turbo\":%s,"
+    "\"log\":%s,\"eta\":%ld,\"queued\":%d,\"heap\":%u,\"heapMin\":%u,\"pm\":\"%s\",\"state\":\"%s\"}",
+    JB(bleKeyboard.isConnected()), c.wpm, (unsigned)measuredWpm, JB(c.strict), c.jitterPct, c.thinkChance, JB(c.typos),
+    JB(c.longPauses), c.longPauseMinMs, c.longPauseMaxMs, c.longPausePct, c.newlineMode, JB(c.codeMode), c.layout,
+    JB(c.digraphs), (unsigned long)typedChars, JB(on), JB(isPaused()), c.typoMaxChars, c.mistakePct, c.holdMinMs,
+    c.holdMaxMs, JB(c.turbo), JB(c.logging), eta > 0 ? eta : 0L, poolCount(SLOT_READY) + poolCount(SLOT_FILLING),
+    (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMinFreeHeap(), POWER_MODE_NAMES[powerMode], on ? (hidWaiting ? "Waiting for BLE..." : "Typing...") : "Ready.");
+}
+
+esp_err_t handleStatus(httpd_req_t *req){
+  statusJson(statusBuf, sizeof(statusBuf));
+  return reply(req, 200, "application/json", statusBuf);
+}
+
+// /config args onto the live config; false if there was nothing to change. Server task only (single writer).
+static bool configApply(const QueryArgs &args){
+  EngineConfig c = cfgSnapshot();
+  bool changed=false;
+  if(args.has("wpm")){ c.wpm = clampInt(args.toInt("wpm"), 10, 300); changed=true; }
+  if(args.has("strict")){ c.strict = (args.toInt("strict")!=0); changed=true; }
+  if(args.has("jitter")){ c.jitterPct = clampInt(args.toInt("jitter"), 5, 45); changed=true; }
+  if(args.has("think")){ c.thinkChance = clampInt(args.toInt("think"), 0, 100); changed=true; }
+  if(args.has("typos")){ c.typos = (args.toInt("typos")!=0); changed=true; }
+  if(args.has("lpen")){ c.longPauses = (args.toInt("lpen")!=0); changed=true; }
+  if(args.has("lpc")){ c.longPausePct = clampInt(args.toInt("lpc"), 0, 100); changed=true; }
+  if(args.has("lpmin")){ c.longPauseMinMs = clampInt(args.toInt("lpmin"), 50, 20000); changed=true; }
+  if(args.has("lpmax")){ c.longPauseMaxMs = clampInt(args.toInt("lpmax"), 50, 30000); changed=true; }
+  if(args.has("nl")){ c.newlineMode = clampInt(args.toInt("nl"), 0, 2); changed=true; }
+  if(args.has("codemode")){ c.codeMode = (args.toInt("codemode")!=0); changed=true; }
+  if(args.has("digraph")){ c.digraphs = (args.toInt("digraph")!=0); changed=true; }
+  if(args.has("layout")){ c.layout = clampInt(args.toInt("layout"), 0, LAYOUT_COUNT - 1); changed=true; }
 
-// Typing engine helpers: create a mistake chunk (max length configured) — returns the mistaken string
-String createMistakeChunk(char correctChar, int len){
-  String s;
-  for(int i=0;i<len;i++){
-    // for better realism pick neighboring letters sometimes; fallback to random lowercase
-    char ch = 'a' + (random(0,26));
-    if(isupper(correctChar) && random(0,2)) ch = toupper(ch);
-    s += ch;
+  // Pro knobs
+  if(args.has("typoMax")){ c.typoMaxChars = clampInt(args.toInt("typoMax"), 1, 6); changed=true; }
+  if(args.has("mistake")){ c.mistakePct = clampInt(args.toInt("mistake"), 0, 100); changed=true; }
+  if(args.has("holdMin")){ c.holdMinMs = clampInt(args.toInt("holdMin"), 2, 1000); changed=true; }
+  if(args.has("log")){ c.logging = (args.toInt("log")!=0); changed=true; }
+  if(args.has("turbo")){ c.turbo = (args.toInt("turbo")!=0); changed=true; }
+  if(args.has("holdMax")){ c.holdMaxMs = clampInt(args.toInt("holdMax"), 2, 2000); changed=true; }
+  if(c.holdMinMs > c.holdMaxMs){ int t = c.holdMinMs; c.holdMinMs = c.holdMaxMs; c.holdMaxMs = t; }
+
+  if(c.longPauseMinMs > c.longPauseMaxMs){ int t = c.longPauseMinMs; c.longPauseMinMs = c.longPauseMaxMs; c.longPauseMaxMs = t; }
+  if(changed){ cfgPublish(c); profile = 0; cfgChanged(); }
+  return changed;
+}
+
+esp_err_t handleConfig(httpd_req_t *req){
+  QueryArgs args(req);
+  bool changed = configApply(args);
+  return reply(req, changed?200:400, "text/plain", changed?"Config updated":"No changes");
+}
+
+
+// Live WPM from the slider; like the rest of /config a running job picks it up at its next word
+esp_err_t handleLiveWpm(httpd_req_t *req){
+  QueryArgs args(req);
+  if(!args.has("wpm")) return reply(req, 400, "text/plain", "No wpm provided");
+  EngineConfig c = cfgSnapshot();
+  c.wpm = clampInt(args.toInt("wpm"), 10, 300);
+  cfgPublish(c); profile = 0; cfgChanged();
+  char msg[32]; snprintf(msg, sizeof(msg), "Live WPM set to %d", c.wpm);
+  return reply(req, 200, "text/plain", msg);
+}
+
+// Hand a new job to the typer: streamed into textRing when the typer is free and nothing is queued, otherwise
+// into a jobPool slot. Returns 0 (streamed), 1 (queued, slot set) or the HTTP status to reject with. Server task only.
+static uint32_t jobIdNext = 1;
+int startTypeJob(uint32_t expected, uint32_t &id, int &slot, bool plan = false){
+  if(uploadBusy.load()) return 409; // one body at a time, including a stopped job's body still draining
+  if(!bleKeyboard.isConnected()) return 503;
+  id = jobIdNext++;
+  int idle = 0;
+  if(poolCount(SLOT_READY) == 0 && ringRefs.compare_exchange_strong(idle, 2)){
+    textRingBegin(expected, plan);
+    // mark the job running before handing it over so nothing else can claim the ring; new jobs start unpaused
+    xEventGroupClearBits(typerEvents, EVT_STOP);
+    xEventGroupSetBits(typerEvents, EVT_TYPING | EVT_RESUME);
+    TypeJob job = { expected, id };
+    if(xQueueSend(jobQueue, &job, 0) != pdTRUE){ xEventGroupClearBits(typerEvents, EVT_TYPING); ringRefs.store(0); return 503; }
+    slot = -1;
+  } else {
+    if(expected > JOB_SLOT_SIZE) return 413;
+    slot = poolAlloc();
+    if(slot < 0) return 409;
+    jobPool[slot].id = id; jobPool[slot].plan = plan;
   }
-  return s;
+  uploadBusy.store(true);
+  if(statusTaskHandle) xTaskNotifyGive(statusTaskHandle); // live status ticks while the job runs
+  return slot < 0 ? 0 : 1;
 }
 
-// Send a sequence of characters (with optional per-character small hold delays)
-void sendCharsWithHold(const String &seq, int holdMin = 18, int holdMax = 80){
-  for(size_t k=0;k<seq.length() && typingActive;++k){
-    sendChar(seq[k]);
-    // simulate key hold by small additional delay (not perfect true keydown)
-    int hold = random(holdMin, holdMax+1);
-    logKeystroke(String("CHAR:") + seq[k] + String(" hold=") + String(hold));
-    coopDelay(hold);
+// Drop one textRing reference; the last holder (if it isn't the typer itself) wakes the typer for queued slots
+static void ringRelease(){
+  if(ringRefs.fetch_sub(1) == 1){ TypeJob wake = { 0, 0 }; xQueueSend(jobQueue, &wake, 0); }
+}
+
+// slot -1 = streamed into textRing; save: snippet buffer; doc >= 0: body stored as that document instead (docReceive);
+// fleet: bitmask of fleet workers the body is passed on to instead (fleetReceive)
+struct UploadJob { httpd_req_t *req; uint32_t id; int slot; uint8_t *save; bool plan; int doc; uint32_t fleet; };
+
+static esp_err_t replyJobRejected(httpd_req_t *req, int st){
+  if(st == 409) return reply(req, 409, "text/plain", uploadBusy.load() ? "Busy: upload in progress" : "Busy: queue full");
+  if(st == 413) return reply(req, 413, "text/plain", "Too long to queue; send it when the typer is free");
+  return reply(req, 503, "text/plain", bleKeyboard.isConnected() ? "Typer not ready" : "BLE not connected");
+}
+
+// POST /type?snippet=<id> — type a cached snippet: copied straight into textRing or a slot, nothing to upload
+static esp_err_t typeSnippet(httpd_req_t *req, uint32_t sid){
+  xSemaphoreTake(snippetLock, portMAX_DELAY);
+  Snippet *e = snippetFind(sid);
+  if(!e){ xSemaphoreGive(snippetLock); return reply(req, 404, "text/plain", "No such snippet"); }
+  uint32_t id; int slot;
+  int st = startTypeJob(e->len, id, slot);
+  if(st > 1){ xSemaphoreGive(snippetLock); return replyJobRejected(req, st); }
+  if(slot < 0){
+    memcpy(textRing.buf, e->text, e->len);
+    textRing.code = e->code; textRing.plan = false;
+    textRing.wr.store(e->len, std::memory_order_release);
+    textRingEnd(); ringRelease();
+  } else {
+    JobSlot &js = jobPool[slot];
+    memcpy(js.text, e->text, e->len); js.len = e->len; js.code = e->code; js.plan = false;
+    poolCommit(js);
   }
+  e->uses++; e->lastUse = ++snippetClock;
+  uint32_t len = e->len;
+  xSemaphoreGive(snippetLock);
+  uploadBusy.store(false);
+  char msg[64];
+  if(slot < 0) snprintf(msg, sizeof(msg), "Typing snippet %08x (%u chars)", (unsigned)sid, (unsigned)len);
+  else snprintf(msg, sizeof(msg), "Queued job %u (snippet %08x)", (unsigned)id, (unsigned)sid);
+  return reply(req, 200, "text/plain", msg);
 }
 
-// Typing engine — Code Mode: strip ALL leading non-newline whitespace per-line, then type
-void typeLikeHuman(const String &rawText){
-  if(!bleKeyboard.isConnected()) return;
+// POST /type — starts typing (or queues the job) at once; the body itself is read by uploadTask.
+// ?save=1 also keeps the filtered body in the snippet cache; ?snippet=<id> types a cached one instead of a body;
+// ?plan=1 means the body is a binary keystroke plan (tools/make_plan.py) that is replayed as is;
+// ?file=<name> types a stored document (see Document store).
+static esp_err_t typeFile(httpd_req_t *req, const QueryArgs &args);
+esp_err_t handleType(httpd_req_t *req){
+  QueryArgs args(req);
+  if(args.has("snippet")) return typeSnippet(req, args.toHex("snippet"));
+  if(args.has("file")) return typeFile(req, args);
+  if(req->content_len == 0) return reply(req, 400, "text/plain", "Empty body");
+  UploadJob u = { NULL, 0, -1, NULL, args.toInt("plan") != 0, -1, 0 };
+  if(u.plan && args.toInt("save")) return reply(req, 400, "text/plain", "Plans can't be saved as snippets");
+  if(args.toInt("save")){
+    if(req->content_len > SNIPPET_MAX_LEN) return reply(req, 413, "text/plain", "Too long to save as a snippet");
+    u.save = snippetStage(req->content_len);
+    if(!u.save) return reply(req, 503, "text/plain", "No memory for the snippet");
+  }
+  int st = startTypeJob(req->content_len, u.id, u.slot, u.plan);
+  if(st > 1){ if(u.save) snippetCommit(0, false); return replyJobRejected(req, st); }
+  if(httpd_req_async_handler_begin(req, &u.req) != ESP_OK){
+    if(u.slot < 0){ requestStop(); textRingEnd(); ringRelease(); } else jobPool[u.slot].state.store(SLOT_FREE);
+    uploadBusy.store(false);
+    if(u.save) snippetCommit(0, false);
+    return reply(req, 503, "text/plain", "Typer not ready");
+  }
+  xQueueSend(uploadQueue, &u, portMAX_DELAY); // never waits: one upload at a time (uploadBusy)
+  return ESP_OK;
+}
 
-  // Set per-session speed multiplier and randomization
-  sessionSpeedMultiplier = 1.0f + (random(-10,11)/100.0f); // +/-10%
+// A /type body on its way in: filtered (or, for a plan, copied) into textRing or its queue slot, plus the snippet
+// copy. uploadTask feeds HTTP bodies through it and fleetTask jobs sent by a coordinator; uploadBusy means only
+// one is open at a time.
+struct BodySink { JobSlot *js; uint8_t *save; bool plan, badPlan; uint32_t saveLen; size_t got; };
+static TextTransform slotTransform, saveTransform;
 
-  // If code mode OFF, use existing pipeline with newline preprocessing
-  if(!codeMode){
-    String text = preprocessText(rawText);
-    size_t N = text.length();
-    if(N == 0) return;
+static void sinkBegin(BodySink &s, int slot, bool plan, uint8_t *save){
+  s = { slot >= 0 ? &jobPool[slot] : NULL, save, plan, false, 0, 0 };
+  if(s.js){ EngineConfig c = cfgSnapshot(); s.js->len = 0; s.js->code = c.codeMode; s.js->plan = plan; slotTransform.begin(c.codeMode, (uint8_t)c.newlineMode); }
+  saveTransform = s.js ? slotTransform : textTransform; // same mode, nothing consumed yet
+}
 
-    typingActive = true;
-    paused = false; // ensure not paused when starting
-    typedChars = 0;
+// One chunk. False once a plan turns out not to be one (the rest must be dropped).
+static bool sinkPut(BodySink &s, uint8_t *chunk, size_t n){
+  if(s.plan){
+    // bytes go in unfiltered; only the magic is checked here, the player stops at the first bad event
+    if(s.got == 0 && (n < 3 || chunk[0] != 'K' || chunk[1] != 'P' || chunk[2] != PLAN_VERSION)){ s.badPlan = true; return false; }
+    s.got += n;
+    if(s.js){ memcpy(s.js->text + s.js->len, chunk, n); s.js->len += n; }
+    else if(typingActive()) feedRaw(chunk, n);
+    return true;
+  }
+  s.got += n;
+  if(s.save){
+    // own transform, so the copy is complete even when a /stop leaves the ring unfed
+    const uint8_t *in = chunk; char c;
+    while(saveTransform.next(in, chunk + n, c)) s.save[s.saveLen++] = (uint8_t)c;
+  }
+  if(s.js){
+    // filtered text is never longer than the body, which startTypeJob checked against JOB_SLOT_SIZE
+    const uint8_t *in = chunk; char c;
+    while(slotTransform.next(in, chunk + n, c)) s.js->text[s.js->len++] = (uint8_t)c;
+  } else if(typingActive()) feedChunk(chunk, n); // waits while the ring is full; after /stop the rest is drained unread
+  return true;
+}
 
-    int sessionWPM = clampInt(configuredWPM + random(-2,3), 10, 300);
-    float baseMs = ms_per_char_for_wpm(sessionWPM) * sessionSpeedMultiplier;
-    float jitterPct = clampInt(jitterStrengthPct,5,45) / 100.0f;
-    jitterPct = capJitterForWPM(sessionWPM, jitterPct);
-    bool strict = strictWPM;
+// Hand the job over (complete) or drop it; keeps or releases the snippet copy. Returns that snippet's id, or 0.
+static uint32_t sinkEnd(BodySink &s, bool complete){
+  if(!s.js){ if(s.badPlan) requestStop(); textRingEnd(); ringRelease(); }
+  else if(!complete || s.js->len == 0) s.js->state.store(SLOT_FREE);
+  else poolCommit(*s.js);
+  uint32_t sid = s.save ? snippetCommit(complete ? s.saveLen : 0, saveTransform.stripLeading) : 0;
+  uploadBusy.store(false);
+  return sid;
+}
 
-    const float MIN_DELAY = 3.0f; const float CORR_LIMIT = 0.5f;
-    unsigned long startMs = millis();
+// Upload task (core 0): reads each detached /type body and filters it straight into textRing or its slot
+#define UPLOAD_CHUNK 1024
+#define UPLOAD_MAX_TIMEOUTS 3   // consecutive recv timeouts (recv_wait_timeout each) before giving up on a client
+static void docReceive(const UploadJob &u, uint8_t *chunk, size_t cap);
+#if defined(TYPIST_FLEET_KEY)
+static void fleetReceive(const UploadJob &u, uint8_t *chunk, size_t cap);
+#endif
+void uploadTask(void *arg){
+  static uint8_t chunk[UPLOAD_CHUNK];
+  for(;;){
+    UploadJob u;
+    if(xQueueReceive(uploadQueue, &u, portMAX_DELAY) != pdTRUE) continue;
+    if(u.doc >= 0){ docReceive(u, chunk, sizeof(chunk)); continue; }
+#if defined(TYPIST_FLEET_KEY)
+    if(u.fleet){ fleetReceive(u, chunk, sizeof(chunk)); continue; }
+#endif
+    httpd_req_t *req = u.req;
+    BodySink s;
+    sinkBegin(s, u.slot, u.plan, u.save);
+    size_t left = req->content_len;
+    int timeouts = 0;
+    while(left){
+      int n = httpd_req_recv(req, (char*)chunk, left < sizeof(chunk) ? left : sizeof(chunk));
+      if(n == HTTPD_SOCK_ERR_TIMEOUT && ++timeouts < UPLOAD_MAX_TIMEOUTS) continue;
+      if(n <= 0) break;
+      timeouts = 0;
+      if(!sinkPut(s, chunk, n)) break;
+      left -= n;
+    }
+    char msg[96];
+    if(s.badPlan) snprintf(msg, sizeof(msg), "Not a keystroke plan");
+    else if(left) snprintf(msg, sizeof(msg), "Upload aborted (%u chars)", (unsigned)s.got);
+    else if(s.js) snprintf(msg, sizeof(msg), "Queued job %u (%u chars)", (unsigned)s.js->id, (unsigned)s.got);
+    else snprintf(msg, sizeof(msg), "Typing started (%u chars)", (unsigned)s.got);
+    uint32_t sid = sinkEnd(s, !left);
+    if(sid){ size_t m = strlen(msg); snprintf(msg + m, sizeof(msg) - m, ", saved as snippet %08x", (unsigned)sid); }
+    reply(req, left ? 400 : 200, "text/plain", msg);
+    httpd_req_async_handler_complete(req);
+  }
+}
 
-    int mistakesCurrently = 0;
+// ---------------- Document store ----------------
+// Sources too large for one /type body are uploaded once and typed from storage. POST /docs?name=<n> keeps the raw
+// body on LittleFS (in PSRAM with ?store=ram, or when there is no file system; RAM copies don't survive a reboot),
+// /type?file=<n> plays it with the filter mode of the moment. docTask reads DOC_CHUNK-byte windows into textRing
+// only while the ring has room for a whole window, so the planner always has buffered text ahead of the window
+// being read and RAM use is the same for any file size. /type?file=<n>&resume=1 continues a stopped job at the
+// first char that wasn't typed: docTask leaves SourceMarks (engine.h) as it feeds, and the typer maps typedChars
+// back through them.
+// Flash writes and deletes stall the flash cache on both cores, so like NVS they are refused while typing.
+#define DOC_MAX 8
+#define DOC_NAME_LEN 24
+#define DOC_DIR "/docs"
+#define DOC_CHUNK 1024
+struct Doc {
+  char name[DOC_NAME_LEN];   // "" = free entry
+  uint32_t size;
+  bool ready;                // upload complete
+  uint8_t *ram;              // PSRAM copy; NULL = LittleFS file DOC_DIR/name
+};
+struct DocFeed {
+  int doc;                   // entry being played (can't be replaced or deleted), -1 = none
+  uint8_t holders;           // docTask and the typer; the last one to finish clears doc
+  uint32_t jobId, base;      // base: chars of the document typed by earlier (resumed) jobs
+  SourcePos start;
+  SourceMarks marks;
+};
+struct DocResume { char name[DOC_NAME_LEN]; SourcePos at; uint32_t chars; }; // name "" = nothing to resume
+Doc docs[DOC_MAX];
+DocFeed docFeed;
+DocResume docResume;
+SemaphoreHandle_t docLock = NULL;  // docs, docFeed marks, docResume
+QueueHandle_t docQueue = NULL;     // int: docFeed is set up, start feeding
+TaskHandle_t docTaskHandle = NULL;
+bool docFlash = false;             // LittleFS mounted
+static File docUpload;             // flash document uploadTask is writing
+
+static bool docNameOk(const char *n){
+  size_t len = strlen(n);
+  if(len == 0 || len >= DOC_NAME_LEN) return false;
+  for(const char *p = n; *p; p++) if(!isalnum((unsigned char)*p) && *p != '.' && *p != '-' && *p != '_') return false;
+  return true;
+}
+static Doc *docFind(const char *name){ for(Doc &d : docs) if(d.name[0] && strcmp(d.name, name) == 0) return &d; return NULL; }
+static void docPath(const char *name, char *out, size_t n){ snprintf(out, n, DOC_DIR "/%s", name); }
+static void docDrop(Doc &d){
+  if(d.ram) free(d.ram);
+  else { char p[40]; docPath(d.name, p, sizeof(p)); LittleFS.remove(p); }
+  if(strcmp(docResume.name, d.name) == 0) docResume.name[0] = 0;
+  d.name[0] = 0; d.size = 0; d.ready = false; d.ram = NULL;
+}
 
-    for(size_t i=0;i<N && typingActive;++i){
-      if(!bleKeyboard.isConnected()) break;
+// Boot: mount LittleFS (formatted on first use) and list the documents already stored
+void docsBegin(){
+  docLock = xSemaphoreCreateMutex();
+  docQueue = xQueueCreate(1, sizeof(int));
+  docFeed.doc = -1;
+  docFlash = LittleFS.begin(true);
+  if(!docFlash){ Serial.println("LittleFS not mounted; documents go to PSRAM only"); return; }
+  if(!LittleFS.exists(DOC_DIR)) LittleFS.mkdir(DOC_DIR);
+  File dir = LittleFS.open(DOC_DIR);
+  int k = 0;
+  for(File f = dir.openNextFile(); f && k < DOC_MAX; f = dir.openNextFile()){
+    if(!f.isDirectory() && docNameOk(f.name())){
+      Doc &d = docs[k++];
+      strncpy(d.name, f.name(), DOC_NAME_LEN - 1); d.size = f.size(); d.ready = true; d.ram = NULL;
+    }
+    f.close();
+  }
+  dir.close();
+}
 
-      // If paused, wait here (still service HTTP)
-      while(paused && typingActive){ server.handleClient(); delay(1); yield(); }
+static void docFeedRelease(){ if(--docFeed.holders == 0) docFeed.doc = -1; } // under docLock
 
-      unsigned long now = millis(); float elapsed = float(now - startMs);
-      size_t remaining = (N - i); if(remaining==0) remaining = 1;
-      float idealElapsed = float(i) * baseMs;
-      float error = elapsed - idealElapsed;
-      float correction = -error / float(remaining);
-      if(correction > baseMs*CORR_LIMIT) correction = baseMs*CORR_LIMIT;
-      if(correction < -baseMs*CORR_LIMIT) correction = -baseMs*CORR_LIMIT;
+static void docMarkPush(const SourcePos &m){
+  xSemaphoreTake(docLock, portMAX_DELAY);
+  docFeed.marks.push(m);
+  xSemaphoreGive(docLock);
+}
 
-      // log-normal sampling for humanlike spikes
-      float sigma = 0.7f; // higher sigma -> heavier tails
-      float nextDelay = lognormal_sample_ms(baseMs + correction, sigma);
-      if(nextDelay < MIN_DELAY) nextDelay = MIN_DELAY;
-      // apply jitter as multiplicative noise
-      float jitterFactor = 1.0f + ((random(-1000,1001)/1000.0f) * jitterPct);
-      nextDelay *= jitterFactor; if(nextDelay < MIN_DELAY) nextDelay = MIN_DELAY;
+// Typer task, right after a document job: keep where it stopped for /type?file=&resume=1
+void docJobEnded(uint32_t typed){
+  xSemaphoreTake(docLock, portMAX_DELAY);
+  docResume.name[0] = 0;
+  bool complete = textRing.eof.load(std::memory_order_acquire) && typed >= textRing.wr.load(std::memory_order_acquire);
+  if(!complete && docFeed.marks.resumeAt(typed, docResume.at)){
+    docResume.chars = docFeed.base + typed;
+    strcpy(docResume.name, docs[docFeed.doc].name);
+  }
+  docFeedRelease();
+  xSemaphoreGive(docLock);
+}
 
-      char c = text[i];
-      bool isSpace = (c==' ');
-      bool isPunct = (c=='.'||c==','||c=='!'||c=='?'||c==';'||c==':');
+// Doc task (core 0): streams docFeed's document into textRing, one window whenever the ring can take it whole
+void docTask(void *arg){
+  static uint8_t window[DOC_CHUNK];
+  for(;;){
+    int idx;
+    if(xQueueReceive(docQueue, &idx, portMAX_DELAY) != pdTRUE) continue;
+    const Doc &d = docs[idx];
+    SourceFeed feed;
+    SourcePos mark = feed.begin(textTransform, docFeed.start);
+    docMarkPush(mark);
+    File f;
+    if(!d.ram){ char p[40]; docPath(d.name, p, sizeof(p)); f = LittleFS.open(p, FILE_READ); if(f) f.seek(feed.pos.off); }
+    while(feed.pos.off < d.size && typingActive() && (d.ram || f)){
+      if(textRingFree() < DOC_CHUNK){ vTaskDelay(pdMS_TO_TICKS(5)); continue; }
+      uint32_t n = std::min<uint32_t>(DOC_CHUNK, d.size - feed.pos.off);
+      if(!d.ram && f.read(window, n) != n) break;
+      if(feed.put(d.ram ? d.ram + feed.pos.off : window, n, mark)) docMarkPush(mark);
+      notifyTyper(); // new text for a planner that ran dry
+    }
+    if(f) f.close();
+    textRingEnd(); ringRelease();
+    xSemaphoreTake(docLock, portMAX_DELAY);
+    docFeedRelease();
+    xSemaphoreGive(docLock);
+  }
+}
 
-      if(!strict && enableLongPauses && isSpace && (random(0,100) < longPausePercent)){
-        coopDelay(random(longPauseMinMs, longPauseMaxMs+1)); if(!typingActive) break;
-      }
+// POST /type?file=<name>[&resume=1] — nothing to upload; only starts when the typer is free
+static esp_err_t typeFile(httpd_req_t *req, const QueryArgs &args){
+  char name[DOC_NAME_LEN + 8];
+  if(!args.text("file", name, sizeof(name)) || !docNameOk(name)) return reply(req, 404, "text/plain", "No such document");
+  bool resume = args.toInt("resume") != 0;
+  xSemaphoreTake(docLock, portMAX_DELAY);
+  Doc *d = docFind(name);
+  int st = (!d || !d->ready) ? 404 : (resume && strcmp(docResume.name, name) != 0) ? 410 : docFeed.doc >= 0 ? 409 : 0;
+  SourcePos at = {};
+  uint32_t base = 0;
+  if(resume && !st){ at = docResume.at; at.ring = 0; base = docResume.chars; } // the new job's ring starts empty
+  xSemaphoreGive(docLock);
+  if(st == 404) return reply(req, 404, "text/plain", "No such document");
+  if(st == 410) return reply(req, 404, "text/plain", "Nothing to resume in that document");
+  if(st == 409) return reply(req, 409, "text/plain", "Busy: previous document still feeding");
+  // docFeed is in place before the typer can see the job: it may end it (BLE gone) before this handler returns
+  if(!resume){ at.startOfLine = true; at.lastCR = false; }
+  xSemaphoreTake(docLock, portMAX_DELAY);
+  docFeed.doc = (int)(d - docs); docFeed.holders = 2; docFeed.jobId = jobIdNext; docFeed.base = base;
+  docFeed.start = at; docFeed.marks.clear();
+  xSemaphoreGive(docLock);
+  uint32_t id; int slot;
+  st = startTypeJob(d->size - at.off, id, slot);
+  if(st){
+    xSemaphoreTake(docLock, portMAX_DELAY);
+    docFeedRelease(); docFeedRelease(); // neither docTask nor the typer will see this job
+    xSemaphoreGive(docLock);
+    if(st == 1){ jobPool[slot].state.store(SLOT_FREE); uploadBusy.store(false); return reply(req, 409, "text/plain", "Busy: documents start when the typer is free"); }
+    return replyJobRejected(req, st);
+  }
+  uploadBusy.store(false); // no body to read: docTask fills the ring
+  int idx = docFeed.doc;
+  xQueueSend(docQueue, &idx, 0);
+  char msg[96];
+  snprintf(msg, sizeof(msg), "Typing %s from byte %u (%u chars done)", name, (unsigned)at.off, (unsigned)base);
+  return reply(req, 200, "text/plain", msg);
+}
 
-      bool alnum = ((c>='a'&&c<='z')||(c>='A'&&c<='Z')||(c>='0'&&c<='9'));
-      bool beginTypo = (!strict) && enableTypos && (random(0,100) < mistakePercent) && alnum && (mistakesCurrently < maxSimultaneousErrors);
-      if(beginTypo){
-        // decide how many chars to include in this mistake (1..typoMaxChars)
-        int len = clampInt(1 + random(0, typoMaxChars-1), 1, typoMaxChars);
-        // ensure we don't exceed buffer
-        if((int)(N - i) < len) len = (int)(N - i);
-        // create wrong chunk
-        String wrong = createMistakeChunk(c, len);
-        // send wrong chunk (with holds)
-        sendCharsWithHold(wrong, holdMinMs, holdMaxMs);
-        logKeystroke(String("MISTAKE_SENT:") + wrong);
-        // short pause then backspace the wrong chunk
-        coopDelay(max(40, (int)nextDelay)); if(!typingActive) break;
-        for(int b=0;b<len && typingActive;++b){ sendBackspace(); coopDelay(random(20,60)); }
-        logKeystroke(String("MISTAKE_BS:") + String(len));
-        // then type the correct len characters normally (replay portion of text)
-        for(int r=0;r<len && typingActive;++r){
-          char rc = text[i + r];
-          sendChar(rc);
-          int extraHold = random(holdMinMs, holdMaxMs+1);
-          coopDelay((unsigned long)max((int)nextDelay/2, extraHold));
-        }
-        // advance i by len-1 (loop will i++)
-        i += (len - 1);
-        mistakesCurrently++;
-      } else {
-        sendChar(c);
-        int extra = 0;
-        if(!strict){
-          if(isSpace) extra += random(40,140);
-          if(extraPunctPause && isPunct) extra += random(80,220);
-          if(c == '\n' || c == '\r') extra += random(120,320);
-        }
-        // small hold after printing
-        int hold = random(holdMinMs, holdMaxMs+1);
-        coopDelay((unsigned long)nextDelay + extra + hold);
-      }
+// POST /docs?name=<name>[&store=ram] — store the body (replaces a document of that name); read by uploadTask
+esp_err_t handleDocPut(httpd_req_t *req){
+  QueryArgs args(req);
+  char name[DOC_NAME_LEN + 8];
+  if(!args.text("name", name, sizeof(name)) || !docNameOk(name)) return reply(req, 400, "text/plain", "Bad name (1-23 chars of A-Z a-z 0-9 . - _)");
+  if(req->content_len == 0) return reply(req, 400, "text/plain", "Empty body");
+  bool ram = args.equals("store", "ram") || !docFlash;
+  if(ram && !psramFound()) return reply(req, 503, "text/plain", "No PSRAM and no file system");
+  if(!ram && typingActive()) return reply(req, 409, "text/plain", "Busy: flash writes wait until typing ends");
+  if(!ram && LittleFS.totalBytes() - LittleFS.usedBytes() < req->content_len + 4096) return reply(req, 413, "text/plain", "Not enough flash");
+  bool idle = false;
+  if(!uploadBusy.compare_exchange_strong(idle, true)) return reply(req, 409, "text/plain", "Busy: upload in progress");
+  xSemaphoreTake(docLock, portMAX_DELAY);
+  Doc *d = docFind(name);
+  int st = 0;
+  if(d && docFeed.doc == (int)(d - docs)) st = 409;
+  else {
+    if(d) docDrop(*d);
+    else for(Doc &e : docs) if(!e.name[0]){ d = &e; break; }
+    if(!d) st = 413;
+    else if(ram && !(d->ram = (uint8_t*)ps_malloc(req->content_len))) st = 503;
+    else if(!ram){ char p[40]; docPath(name, p, sizeof(p)); docUpload = LittleFS.open(p, FILE_WRITE); if(!docUpload) st = 503; }
+    if(!st){ strcpy(d->name, name); d->size = 0; d->ready = false; }
+  }
+  xSemaphoreGive(docLock);
+  UploadJob u = { NULL, 0, -1, NULL, false, d ? (int)(d - docs) : -1, 0 };
+  if(!st && httpd_req_async_handler_begin(req, &u.req) != ESP_OK){
+    xSemaphoreTake(docLock, portMAX_DELAY);
+    if(!ram) docUpload.close();
+    docDrop(*d);
+    xSemaphoreGive(docLock);
+    st = 503;
+  }
+  if(st){
+    uploadBusy.store(false);
+    if(st == 409) return reply(req, 409, "text/plain", "Busy: that document is being typed");
+    if(st == 413) return reply(req, 413, "text/plain", "Document table full");
+    return reply(req, 503, "text/plain", "No room for the document");
+  }
+  xQueueSend(uploadQueue, &u, portMAX_DELAY); // never waits: one upload at a time (uploadBusy)
+  return ESP_OK;
+}
 
-      if(!strict && isSpace && thinkingSpaceChance>0 && (random(0,thinkingSpaceChance)==0)){
-        coopDelay(random(400,1000)); if(!typingActive) break;
-      }
+// uploadTask: the raw body of a POST /docs, copied to its file or PSRAM buffer
+static void docReceive(const UploadJob &u, uint8_t *chunk, size_t cap){
+  httpd_req_t *req = u.req;
+  Doc &d = docs[u.doc];
+  size_t left = req->content_len, got = 0;
+  int timeouts = 0;
+  bool full = false;
+  while(left){
+    int n = httpd_req_recv(req, (char*)chunk, left < cap ? left : cap);
+    if(n == HTTPD_SOCK_ERR_TIMEOUT && ++timeouts < UPLOAD_MAX_TIMEOUTS) continue;
+    if(n <= 0) break;
+    timeouts = 0;
+    if(d.ram) memcpy(d.ram + got, chunk, n);
+    else if(docUpload.write(chunk, n) != (size_t)n){ full = true; break; }
+    left -= n; got += n;
+  }
+  if(!d.ram) docUpload.close();
+  char msg[96];
+  xSemaphoreTake(docLock, portMAX_DELAY);
+  if(left){
+    snprintf(msg, sizeof(msg), full ? "Flash full after %u bytes" : "Upload aborted (%u bytes)", (unsigned)got);
+    docDrop(d);
+  } else {
+    d.size = got; d.ready = true;
+    snprintf(msg, sizeof(msg), "Stored %s (%u bytes, %s)", d.name, (unsigned)got, d.ram ? "psram" : "flash");
+  }
+  xSemaphoreGive(docLock);
+  uploadBusy.store(false);
+  reply(req, left ? (full ? 413 : 400) : 200, "text/plain", msg);
+  httpd_req_async_handler_complete(req);
+}
+
+esp_err_t handleDocs(httpd_req_t *req){
+  char buf[192 + DOC_MAX * 80];
+  xSemaphoreTake(docLock, portMAX_DELAY);
+  size_t n = snprintf(buf, sizeof(buf), "{\"flash\":%s,\"total\":%u,\"used\":%u,\"psram\":%s,\"docs\":[", docFlash ? "true" : "false",
+                      docFlash ? (unsigned)LittleFS.totalBytes() : 0u, docFlash ? (unsigned)LittleFS.usedBytes() : 0u, psramFound() ? "true" : "false");
+  bool first = true;
+  for(const Doc &d : docs){
+    if(!d.name[0] || !d.ready) continue;
+    n += snprintf(buf + n, sizeof(buf) - n, "%s{\"name\":\"%s\",\"bytes\":%u,\"store\":\"%s\"}", first ? "" : ",",
+                  d.name, (unsigned)d.size, d.ram ? "psram" : "flash");
+    first = false;
+  }
+  n += snprintf(buf + n, sizeof(buf) - n, "],\"playing\":");
+  n += docFeed.doc >= 0 ? snprintf(buf + n, sizeof(buf) - n, "\"%s\"", docs[docFeed.doc].name) : snprintf(buf + n, sizeof(buf) - n, "null");
+  if(docResume.name[0]) snprintf(buf + n, sizeof(buf) - n, ",\"resume\":{\"name\":\"%s\",\"byte\":%u,\"chars\":%u}}",
+                                 docResume.name, (unsigned)docResume.at.off, (unsigned)docResume.chars);
+  else snprintf(buf + n, sizeof(buf) - n, ",\"resume\":null}");
+  xSemaphoreGive(docLock);
+  return reply(req, 200, "application/json", buf);
+}
+
+// GET /docs/delete?name=<name>
+esp_err_t handleDocDelete(httpd_req_t *req){
+  QueryArgs args(req);
+  char name[DOC_NAME_LEN + 8];
+  if(!args.text("name", name, sizeof(name))) return reply(req, 400, "text/plain", "No name provided");
+  xSemaphoreTake(docLock, portMAX_DELAY);
+  Doc *d = docFind(name);
+  int st = !d ? 404 : (docFeed.doc == (int)(d - docs) || !d->ready || (!d->ram && typingActive())) ? 409 : 200;
+  if(st == 200) docDrop(*d);
+  xSemaphoreGive(docLock);
+  if(st == 404) return reply(req, 404, "text/plain", "No such document");
+  if(st == 409) return reply(req, 409, "text/plain", "Busy: document in use or typing in progress");
+  return reply(req, 200, "text/plain", "Deleted");
+}
+
+// ---------------- Fleet (ESP-NOW) ----------------
+// Several boards, each typing into its own host, run from one page. Built in with -DTYPIST_FLEET_KEY='"<secret>"'
+// (the same 16+ char secret on every board). Every board is then a worker, and whichever one the operator opens
+// coordinates the others through /fleet/*. Frames go radio to radio over ESP-NOW on FLEET_CHANNEL: nothing
+// associates, and a round trip takes a few ms. Each board broadcasts a status beacon every FLEET_HELLO_MS; that is
+// how a coordinator finds its workers and what /fleet aggregates. Commands are unicast and acknowledged
+// (stop-and-wait; a resend is re-acked, not re-run). Beacons are unsigned and only informative; each command carries a truncated HMAC-SHA256 keyed by the secret over
+// the worker's session nonce: FL_JOIN opens a session and rotates the nonce, and later commands need a newer seq,
+// so nothing can be forged or replayed without the key. Frames are not encrypted, so job text crosses the air in
+// the clear. A job's body arrives in FLEET_DATA_MAX-byte pieces and goes into the worker's own BodySink (its
+// filter mode, its queue); it has to fit textRing. Commands that start jobs or change config run on the worker's
+// HTTP task (httpd_queue_work), exactly like the same request made locally.
+#if defined(TYPIST_FLEET_KEY)
+#define FLEET_MAX 16                // peers tracked (bitmask in UploadJob::fleet)
+#define FLEET_CHANNEL 1             // soft-AP channel, the same on every board
+#define FLEET_HELLO_MS 1000
+#define FLEET_PEER_TTL_MS 5000      // dropped from the table after this long without a beacon
+#define FLEET_ACK_MS 50
+#define FLEET_RETRIES 6
+#define FLEET_JOB_IDLE_MS 8000      // a worker abandons a half-sent job after this long without a piece (> a stalled upload)
+#define FLEET_MAGIC 0x7f
+#define FLEET_TAG 8                 // HMAC bytes kept
+#define FLEET_FRAME_MAX 250         // ESP-NOW payload limit
+static_assert(sizeof(TYPIST_FLEET_KEY) > 16, "TYPIST_FLEET_KEY needs at least 16 chars");
+
+enum { FL_HELLO, FL_ACK, FL_JOIN, FL_CONFIG, FL_BEGIN, FL_DATA, FL_END, FL_STOP, FL_PAUSE };
+struct __attribute__((packed)) FleetHdr { uint8_t magic, type; uint16_t seq; };
+struct __attribute__((packed)) FleetHello {
+  FleetHdr h;
+  uint32_t nonce;                   // current session nonce (a new one after every join)
+  uint8_t ble, typing, paused, queued;
+  uint16_t wpm, mwpm;
+  uint32_t typed, chars;
+};
+// seq echoes the command; status is what the same local request would answer; val: nonce (JOIN), job id (BEGIN),
+// bytes taken so far (DATA, END)
+struct __attribute__((packed)) FleetAck { FleetHdr h; int16_t status; uint32_t val; };
+struct __attribute__((packed)) FleetBegin { uint32_t len; uint8_t plan; };
+#define FLEET_DATA_MAX (FLEET_FRAME_MAX - sizeof(FleetHdr) - 4 - FLEET_TAG)   // after the 4-byte offset
+
+struct FleetRx { uint8_t mac[6]; uint8_t len; uint8_t d[FLEET_FRAME_MAX]; };
+struct FleetPeer {
+  uint8_t mac[6];
+  uint32_t seenMs;                  // 0 = empty entry
+  FleetHello st;                    // latest beacon
+  uint32_t nonce;                   // coordinator side: the session our FL_JOIN opened
+  bool joined;
+  uint16_t txSeq;
+};
+FleetPeer fleetPeers[FLEET_MAX];
+SemaphoreHandle_t fleetLock = NULL;       // peer table and the worker session
+SemaphoreHandle_t fleetCallLock = NULL;   // one coordinator command in flight
+QueueHandle_t fleetRxQueue = NULL, fleetAckQueue = NULL;
+static const uint8_t FLEET_BCAST[6] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+static uint8_t fleetSelf[6];
+static volatile bool fleetUp = false;    // set once ESP-NOW and fleetTask are running
+
+// Worker session (under fleetLock)
+static uint32_t fleetNonce = 0;
+static uint8_t fleetBoss[6];
+static bool fleetHasBoss = false;
+static uint16_t fleetRxSeq = 0;
+static uint32_t fleetJoinNonce = 0;       // the nonce the current session's FL_JOIN was tagged with
+static FleetAck fleetLastAck;             // answer to fleetRxSeq, resent for duplicates
+static bool fleetAckReady = false;
+static BodySink fleetSink;
+static bool fleetSinkOpen = false;
+static uint32_t fleetSinkOff = 0, fleetSinkLen = 0, fleetSinkMs = 0;
+static FleetRx fleetWork;                 // the command handed to the HTTP task
+static std::atomic<bool> fleetWorkBusy(false);
+
+static void fleetTag(uint32_t nonce, const uint8_t *f, size_t n, uint8_t *out){
+  static const char key[] = TYPIST_FLEET_KEY;
+  uint8_t in[4 + FLEET_FRAME_MAX], mac[32];
+  memcpy(in, &nonce, 4); memcpy(in + 4, f, n);
+  mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), (const uint8_t*)key, sizeof(key) - 1, in, 4 + n, mac);
+  memcpy(out, mac, FLEET_TAG);
+}
+
+// n includes the tag; compared in constant time
+static bool fleetTagOk(uint32_t nonce, const uint8_t *f, size_t n){
+  if(n < sizeof(FleetHdr) + FLEET_TAG) return false;
+  uint8_t t[FLEET_TAG], d = 0;
+  fleetTag(nonce, f, n - FLEET_TAG, t);
+  for(int i=0;i<FLEET_TAG;i++) d |= t[i] ^ f[n - FLEET_TAG + i];
+  return d == 0;
+}
+
+static void fleetAddPeer(const uint8_t *mac){
+  if(esp_now_is_peer_exist(mac)) return;
+  esp_now_peer_info_t p = {};
+  memcpy(p.peer_addr, mac, 6); p.channel = 0; p.ifidx = WIFI_IF_AP; p.encrypt = false;
+  esp_now_add_peer(&p);
+}
+
+static void fleetMacStr(const uint8_t *m, char *out){ sprintf(out, "%02x:%02x:%02x:%02x:%02x:%02x", m[0], m[1], m[2], m[3], m[4], m[5]); }
+
+// 12 hex digits, separators ignored
+static bool fleetParseMac(const char *s, uint8_t *m){
+  int n = 0;
+  for(; *s && n < 12; s++){
+    if(!isxdigit((unsigned char)*s)) continue;
+    uint8_t v = isdigit((unsigned char)*s) ? *s - '0' : (tolower(*s) - 'a' + 10);
+    m[n / 2] = (n & 1) ? (m[n / 2] << 4) | v : v;
+    n++;
+  }
+  return n == 12 && !*s;
+}
 
-      typedChars = i+1;
-      // allow HTTP to service
-      server.handleClient();
+// ESP-NOW receive callback (Wi-Fi task): acks go straight to the waiting coordinator, the rest to fleetTask
+#if ESP_IDF_VERSION_MAJOR >= 5
+static void fleetRecv(const esp_now_recv_info_t *info, const uint8_t *data, int len){
+  const uint8_t *src = info->src_addr;
+#else
+static void fleetRecv(const uint8_t *src, const uint8_t *data, int len){
+#endif
+  if(len < (int)sizeof(FleetHdr) || len > FLEET_FRAME_MAX || data[0] != FLEET_MAGIC) return;
+  FleetRx rx;
+  memcpy(rx.mac, src, 6); rx.len = (uint8_t)len; memcpy(rx.d, data, len);
+  xQueueSend(data[1] == FL_ACK ? fleetAckQueue : fleetRxQueue, &rx, 0);
+}
+
+// Caller holds fleetLock when keep is set (the ack is remembered for resends)
+static void fleetAck(const uint8_t *mac, uint16_t seq, int16_t status, uint32_t val, bool keep){
+  FleetAck a = {};
+  a.h.magic = FLEET_MAGIC; a.h.type = FL_ACK; a.h.seq = seq; a.status = status; a.val = val;
+  if(keep){ fleetLastAck = a; fleetAckReady = true; }
+  esp_now_send(mac, (const uint8_t*)&a, sizeof(a));
+}
+
+// ---- Worker ----
+// HTTP task: commands that must run where local requests do (startTypeJob, config, stop, pause)
+static void fleetWorkRun(void *arg){
+  const FleetRx &rx = fleetWork;
+  FleetHdr hd; memcpy(&hd, rx.d, sizeof(hd));
+  const uint8_t *pl = rx.d + sizeof(FleetHdr);
+  size_t pn = rx.len - sizeof(FleetHdr) - FLEET_TAG;
+  int16_t st = 200;
+  uint32_t val = 0;
+  if(hd.type == FL_BEGIN && pn == sizeof(FleetBegin)){
+    FleetBegin b; memcpy(&b, pl, sizeof(b));
+    xSemaphoreTake(fleetLock, portMAX_DELAY);
+    bool open = fleetSinkOpen;
+    xSemaphoreGive(fleetLock);
+    uint32_t id; int slot;
+    int r = open ? 409 : (!b.len || b.len > TEXT_RING_SIZE) ? 413 : startTypeJob(b.len, id, slot, b.plan != 0);
+    if(r > 1) st = r;
+    else {
+      xSemaphoreTake(fleetLock, portMAX_DELAY);
+      sinkBegin(fleetSink, slot, b.plan != 0, NULL);
+      fleetSinkOpen = true; fleetSinkOff = 0; fleetSinkLen = b.len; fleetSinkMs = millis();
+      xSemaphoreGive(fleetLock);
+      val = id;
     }
+  } else if(hd.type == FL_CONFIG && pn == sizeof(EngineConfig)){
+    EngineConfig c; memcpy(&c, pl, sizeof(c)); // same firmware on every board, so the same layout
+    cfgPublish(c); profile = 0; cfgChanged();
+  } else if(hd.type == FL_STOP) requestStop();
+  else if(hd.type == FL_PAUSE && pn == 1) setPaused(pl[0] != 0);
+  else st = 400;
+  xSemaphoreTake(fleetLock, portMAX_DELAY);
+  fleetAck(rx.mac, hd.seq, st, val, true);
+  xSemaphoreGive(fleetLock);
+  fleetWorkBusy.store(false);
+}
 
-    typingActive = false; paused = false; // clear paused state when finished
-    coopDelay(120 + random(0,300));
+static void fleetCommand(const FleetRx &rx){
+  FleetHdr hd; memcpy(&hd, rx.d, sizeof(hd));
+  fleetAddPeer(rx.mac); // so we can answer
+  xSemaphoreTake(fleetLock, portMAX_DELAY);
+  bool ok = fleetTagOk(fleetNonce, rx.d, rx.len);
+  bool boss = fleetHasBoss && !memcmp(rx.mac, fleetBoss, 6);
+  if(!ok && hd.type == FL_JOIN && boss && hd.seq == fleetRxSeq && fleetTagOk(fleetJoinNonce, rx.d, rx.len)){
+    esp_now_send(rx.mac, (const uint8_t*)&fleetLastAck, sizeof(fleetLastAck)); // our ack to that join was lost
+    xSemaphoreGive(fleetLock);
     return;
   }
+  if(ok && hd.type == FL_JOIN){
+    memcpy(fleetBoss, rx.mac, 6); fleetHasBoss = true; fleetRxSeq = hd.seq; fleetJoinNonce = fleetNonce;
+    do fleetNonce = esp_random(); while(!fleetNonce);
+    fleetAck(rx.mac, hd.seq, 200, fleetNonce, true);
+    xSemaphoreGive(fleetLock);
+    return;
+  }
+  if(!ok || !boss){ xSemaphoreGive(fleetLock); fleetAck(rx.mac, hd.seq, 401, 0, false); return; }
+  int16_t age = (int16_t)(hd.seq - fleetRxSeq);
+  if(age <= 0){
+    // a resend of the last command (ack lost) gets the same answer; older ones are ignored
+    if(age == 0 && fleetAckReady) esp_now_send(rx.mac, (const uint8_t*)&fleetLastAck, sizeof(fleetLastAck));
+    xSemaphoreGive(fleetLock);
+    return;
+  }
+  fleetRxSeq = hd.seq; fleetAckReady = false;
+  const uint8_t *pl = rx.d + sizeof(FleetHdr);
+  size_t pn = rx.len - sizeof(FleetHdr) - FLEET_TAG;
+  if(hd.type == FL_DATA && pn > 4){
+    uint32_t off; memcpy(&off, pl, 4);
+    int16_t st = 200;
+    if(!fleetSinkOpen) st = 409;
+    else if(off != fleetSinkOff || off + (pn - 4) > fleetSinkLen) st = 400;
+    else if(!sinkPut(fleetSink, (uint8_t*)pl + 4, pn - 4)) st = 400; // not a keystroke plan
+    else { fleetSinkOff += pn - 4; fleetSinkMs = millis(); }
+    fleetAck(rx.mac, hd.seq, st, fleetSinkOff, true);
+  } else if(hd.type == FL_END){
+    int16_t st = 409;
+    uint32_t got = fleetSinkOff;
+    if(fleetSinkOpen){
+      bool complete = fleetSinkOff == fleetSinkLen && !fleetSink.badPlan;
+      sinkEnd(fleetSink, complete);
+      fleetSinkOpen = false;
+      st = complete ? 200 : 400;
+    }
+    fleetAck(rx.mac, hd.seq, st, got, true);
+  } else if(!fleetWorkBusy.exchange(true)){
+    fleetWork = rx;
+    if(httpd_queue_work(httpServer, fleetWorkRun, NULL) != ESP_OK){ fleetWorkBusy.store(false); fleetAck(rx.mac, hd.seq, 503, 0, true); }
+  } else fleetAck(rx.mac, hd.seq, 503, 0, true);
+  xSemaphoreGive(fleetLock);
+}
 
-  // ---------------- Code Mode ON: build filtered text that strips leading whitespace per-line
-  {
-    String raw = rawText;
-    int inN = (int)raw.length();
-    if(inN == 0) return;
+static void fleetSeen(const uint8_t *mac, const FleetHello &h){
+  if(!memcmp(mac, fleetSelf, 6)) return;
+  xSemaphoreTake(fleetLock, portMAX_DELAY);
+  FleetPeer *p = NULL, *empty = NULL;
+  for(FleetPeer &e : fleetPeers){
+    if(e.seenMs && !memcmp(e.mac, mac, 6)){ p = &e; break; }
+    if(!e.seenMs && !empty) empty = &e;
+  }
+  if(!p && empty){ p = empty; *p = {}; memcpy(p->mac, mac, 6); fleetAddPeer(mac); }
+  if(p){
+    if(p->joined && h.nonce != p->nonce) p->joined = false; // rebooted, or another coordinator joined it
+    p->st = h; p->seenMs = millis() | 1;
+  }
+  xSemaphoreGive(fleetLock);
+}
 
-    String text;
-    text.reserve(inN);
-    bool startOfLine = true;
+// Fleet task (core 0): beacons from other boards, commands for this one, abandoned jobs
+void fleetTask(void *arg){
+  for(;;){
+    FleetRx rx;
+    bool got = xQueueReceive(fleetRxQueue, &rx, pdMS_TO_TICKS(500)) == pdTRUE;
+    xSemaphoreTake(fleetLock, portMAX_DELAY);
+    if(fleetSinkOpen && millis() - fleetSinkMs > FLEET_JOB_IDLE_MS){ sinkEnd(fleetSink, false); fleetSinkOpen = false; } // coordinator gone
+    xSemaphoreGive(fleetLock);
+    if(!got) continue;
+    if(rx.d[1] == FL_HELLO){
+      FleetHello h;
+      if(rx.len == sizeof(h)){ memcpy(&h, rx.d, sizeof(h)); fleetSeen(rx.mac, h); }
+    } else fleetCommand(rx);
+  }
+}
 
-    for(int i = 0; i < inN; ++i){
-      char c = raw[i];
+// statusTask, every tick: our beacon once per FLEET_HELLO_MS, and peers that went quiet leave the table
+void fleetBeacon(){
+  static uint32_t last = 0;
+  uint32_t now = millis();
+  if(!fleetUp || now - last < FLEET_HELLO_MS) return;
+  last = now;
+  FleetHello h = {};
+  h.h.magic = FLEET_MAGIC; h.h.type = FL_HELLO;
+  h.ble = bleKeyboard.isConnected(); h.typing = typingActive(); h.paused = isPaused(); h.queued = (uint8_t)poolCount(SLOT_READY);
+  h.wpm = (uint16_t)cfgSnapshot().wpm; h.mwpm = measuredWpm; h.typed = (uint32_t)typedChars; h.chars = jobChars;
+  xSemaphoreTake(fleetLock, portMAX_DELAY);
+  h.nonce = fleetNonce;
+  for(FleetPeer &p : fleetPeers) if(p.seenMs && now - p.seenMs > FLEET_PEER_TTL_MS){ esp_now_del_peer(p.mac); p = {}; }
+  xSemaphoreGive(fleetLock);
+  esp_now_send(FLEET_BCAST, (const uint8_t*)&h, sizeof(h));
+}
 
-      // Handle CR and CRLF -> normalized to single '\n'
-      if(c == '\r'){
-        if((i + 1) < inN && raw[i+1] == '\n'){ ++i; } // skip LF after CR
-        text += '\n';
-        startOfLine = true;
-        continue;
-      }
-      // Handle LF
-      if(c == '\n'){
-        text += '\n';
-        startOfLine = true;
-        continue;
-      }
+// After Wi-Fi is up (netTask)
+void fleetBegin(){
+  fleetLock = xSemaphoreCreateMutex();
+  fleetCallLock = xSemaphoreCreateMutex();
+  fleetRxQueue = xQueueCreate(8, sizeof(FleetRx));
+  fleetAckQueue = xQueueCreate(4, sizeof(FleetRx));
+  do fleetNonce = esp_random(); while(!fleetNonce);
+  esp_wifi_get_mac(WIFI_IF_AP, fleetSelf);
+  if(esp_now_init() != ESP_OK){ Serial.println("ESP-NOW failed to start; fleet mode off"); return; }
+  esp_now_register_recv_cb(fleetRecv);
+  fleetAddPeer(FLEET_BCAST);
+  xTaskCreatePinnedToCore(fleetTask, "fleet", 4096, NULL, 2, NULL, SERVER_CORE);
+  fleetUp = true;
+}
 
-      // At this point c is NOT '\r' or '\n'.
-      // If we're at start of line and c is whitespace (space, tab, etc.), skip it.
-      if(startOfLine && isspace((unsigned char)c)){
-        // drop leading whitespace (space, tab, vertical-tab, form-feed, etc.)
-        continue;
-      }
+// ---- Coordinator ----
+// One frame to peer i, resent until its ack arrives. Returns the ack's status, 504 if there was none.
+static int fleetSend(int i, uint8_t type, const void *pl, size_t pn, uint32_t nonce, uint32_t *val){
+  uint8_t f[FLEET_FRAME_MAX], mac[6];
+  xSemaphoreTake(fleetLock, portMAX_DELAY);
+  FleetHdr h = { FLEET_MAGIC, type, ++fleetPeers[i].txSeq };
+  memcpy(mac, fleetPeers[i].mac, 6);
+  xSemaphoreGive(fleetLock);
+  memcpy(f, &h, sizeof(h));
+  if(pn) memcpy(f + sizeof(h), pl, pn);
+  size_t n = sizeof(h) + pn;
+  fleetTag(nonce, f, n, f + n);
+  n += FLEET_TAG;
+  xQueueReset(fleetAckQueue);
+  for(int k=0;k<FLEET_RETRIES;k++){
+    esp_now_send(mac, f, n);
+    TickType_t t0 = xTaskGetTickCount(), wait = pdMS_TO_TICKS(FLEET_ACK_MS);
+    FleetRx rx;
+    for(TickType_t el; (el = xTaskGetTickCount() - t0) < wait && xQueueReceive(fleetAckQueue, &rx, wait - el) == pdTRUE;){
+      FleetAck a;
+      if(rx.len != sizeof(a) || memcmp(rx.mac, mac, 6)) continue;
+      memcpy(&a, rx.d, sizeof(a));
+      if(a.h.seq != h.seq) continue;
+      if(val) *val = a.val;
+      return a.status;
+    }
+  }
+  return 504;
+}
 
-      // Otherwise append and mark not at start-of-line
-      text += c;
-      startOfLine = false;
+// Coordinator: one command to peer i (joining it first if needed). Returns the worker's status: 200, what the same
+// local request would have got, or 504 when it doesn't answer. val: the ack's value.
+static int fleetCall(int i, uint8_t type, const void *pl, size_t pn, uint32_t *val = NULL){
+  xSemaphoreTake(fleetCallLock, portMAX_DELAY);
+  int st = 404;
+  for(int attempt = 0; attempt < 2; attempt++){
+    xSemaphoreTake(fleetLock, portMAX_DELAY);
+    FleetPeer p = fleetPeers[i];
+    xSemaphoreGive(fleetLock);
+    if(!p.seenMs){ st = 404; break; }
+    if(!p.joined){
+      uint32_t nonce = 0;
+      st = fleetSend(i, FL_JOIN, NULL, 0, p.st.nonce, &nonce);
+      if(st != 200) break;
+      xSemaphoreTake(fleetLock, portMAX_DELAY);
+      fleetPeers[i].nonce = p.nonce = nonce; fleetPeers[i].joined = true;
+      xSemaphoreGive(fleetLock);
     }
+    st = fleetSend(i, type, pl, pn, p.nonce, val);
+    if(st != 401) break;
+    xSemaphoreTake(fleetLock, portMAX_DELAY); // session lost (worker rebooted meanwhile): join again
+    fleetPeers[i].joined = false;
+    xSemaphoreGive(fleetLock);
+  }
+  xSemaphoreGive(fleetCallLock);
+  return st;
+}
 
-    // Now type the filtered text using your engine (same as above but with optimized loops)
-    int N = (int)text.length();
-    if(N == 0) return;
-
-    typingActive = true;
-    paused = false;
-    typedChars = 0;
-
-    int sessionWPM = clampInt(configuredWPM + random(-2,3), 10, 300);
-    float baseMs = ms_per_char_for_wpm(sessionWPM) * sessionSpeedMultiplier;
-    float jitterPct = clampInt(jitterStrengthPct,5,45) / 100.0f;
-    jitterPct = capJitterForWPM(sessionWPM, jitterPct);
-    bool strict = strictWPM;
-
-    const float MIN_DELAY = 3.0f; const float CORR_LIMIT = 0.5f;
-    unsigned long startMs = millis();
-
-    int mistakesCurrently = 0;
-
-    for(int i=0; i < N && typingActive; ++i){
-      if(!bleKeyboard.isConnected()) break;
-
-      // If paused, wait here (still service HTTP)
-      while(paused && typingActive){ server.handleClient(); delay(1); yield(); }
-
-      unsigned long now = millis(); float elapsed = float(now - startMs);
-      int remaining = (N - i); if(remaining==0) remaining = 1;
-      float idealElapsed = float(i) * baseMs;
-      float error = elapsed - idealElapsed;
-      float correction = -error / float(remaining);
-      if(correction > baseMs*CORR_LIMIT) correction = baseMs*CORR_LIMIT;
-      if(correction < -baseMs*CORR_LIMIT) correction = -baseMs*CORR_LIMIT;
-
-      float sigma = 0.7f;
-      float nextDelay = lognormal_sample_ms(baseMs + correction, sigma);
-      if(nextDelay < MIN_DELAY) nextDelay = MIN_DELAY;
-      float jitterFactor = 1.0f + ((random(-1000,1001)/1000.0f) * jitterPct);
-      nextDelay *= jitterFactor; if(nextDelay < MIN_DELAY) nextDelay = MIN_DELAY;
-
-      char c = text[i];
-
-      // newline handling (we normalized CRLF -> '\n')
-      if(c == '\n'){
-        sendChar('\n');
-        coopDelay((unsigned long)nextDelay);
-        typedChars = i+1;
-        continue;
-      }
+// ?to=all (default) | next (an idle worker, round robin) | <mac>. Bitmask of peers, 0 if none match.
+static uint32_t fleetTargets(const QueryArgs &args){
+  static int next = 0;
+  if(!fleetUp) return 0;
+  char to[24];
+  if(!args.text("to", to, sizeof(to)) || !to[0]) strcpy(to, "all");
+  uint8_t mac[6];
+  bool all = !strcmp(to, "all"), idle = !strcmp(to, "next"), one = !all && !idle && fleetParseMac(to, mac);
+  uint32_t m = 0;
+  xSemaphoreTake(fleetLock, portMAX_DELAY);
+  for(int k=0;k<FLEET_MAX && (all || idle || one);k++){
+    int i = idle ? (next + k) % FLEET_MAX : k;
+    const FleetPeer &p = fleetPeers[i];
+    if(!p.seenMs) continue;
+    if(idle && p.st.ble && !p.st.typing && !p.st.queued){ m = 1u << i; next = i + 1; break; }
+    if(all || (one && !memcmp(p.mac, mac, 6))) m |= 1u << i;
+  }
+  xSemaphoreGive(fleetLock);
+  return m;
+}
 
-      bool isSpace = (c == ' ');
-      bool isPunct = (c=='.'||c==','||c=='!'||c=='?'||c==';'||c==':');
+// uploadTask: a /fleet/type body, passed on piece by piece to every target that took the job
+static void fleetReceive(const UploadJob &u, uint8_t *chunk, size_t cap){
+  httpd_req_t *req = u.req;
+  FleetBegin b = { (uint32_t)req->content_len, (uint8_t)u.plan };
+  uint32_t live = 0;
+  int asked = 0, ok = 0;
+  for(int i=0;i<FLEET_MAX;i++) if(u.fleet & (1u << i)){ asked++; if(fleetCall(i, FL_BEGIN, &b, sizeof(b)) == 200) live |= 1u << i; }
+  size_t left = req->content_len, got = 0;
+  int timeouts = 0;
+  while(left && live){
+    int n = httpd_req_recv(req, (char*)chunk, left < cap ? left : cap);
+    if(n == HTTPD_SOCK_ERR_TIMEOUT && ++timeouts < UPLOAD_MAX_TIMEOUTS) continue;
+    if(n <= 0) break;
+    timeouts = 0;
+    for(size_t o = 0; o < (size_t)n; o += FLEET_DATA_MAX){
+      uint8_t pl[4 + FLEET_DATA_MAX];
+      uint32_t off = got + o;
+      size_t k = std::min((size_t)FLEET_DATA_MAX, (size_t)n - o);
+      memcpy(pl, &off, 4); memcpy(pl + 4, chunk + o, k);
+      for(int i=0;i<FLEET_MAX;i++) if((live & (1u << i)) && fleetCall(i, FL_DATA, pl, 4 + k) != 200) live &= ~(1u << i);
+    }
+    left -= n; got += n;
+  }
+  for(int i=0;i<FLEET_MAX;i++) if(live & (1u << i)){ if(fleetCall(i, FL_END, NULL, 0) == 200 && !left) ok++; }
+  uploadBusy.store(false);
+  char msg[64]; snprintf(msg, sizeof(msg), "Typing on %d of %d workers (%u chars)", ok, asked, (unsigned)got);
+  reply(req, ok ? 200 : 502, "text/plain", msg);
+  httpd_req_async_handler_complete(req);
+}
 
-      if(!strict && enableLongPauses && isSpace && (random(0,100) < longPausePercent)){
-        coopDelay(random(longPauseMinMs, longPauseMaxMs+1)); if(!typingActive) break;
-      }
+// GET /fleet — {"self":"..","workers":[{"mac":..,"age":ms,"ble":..,"typing":..,"paused":..,"queued":..,"wpm":..,
+// "mwpm":..,"typed":..,"chars":..}],"typing":n,"mwpm":sum,"typed":sum}
+esp_err_t handleFleet(httpd_req_t *req){
+  static char buf[128 + FLEET_MAX * 176]; // server task only
+  if(!fleetUp) return reply(req, 503, "text/plain", "Fleet mode failed to start");
+  char mac[18];
+  fleetMacStr(fleetSelf, mac);
+  size_t n = snprintf(buf, sizeof(buf), "{\"self\":\"%s\",\"workers\":[", mac);
+  uint32_t now = millis(), typing = 0, mwpm = 0, typed = 0;
+  bool first = true;
+  xSemaphoreTake(fleetLock, portMAX_DELAY);
+  for(const FleetPeer &p : fleetPeers){
+    if(!p.seenMs) continue;
+    fleetMacStr(p.mac, mac);
+    n += snprintf(buf + n, sizeof(buf) - n, "%s{\"mac\":\"%s\",\"age\":%u,\"ble\":%s,\"typing\":%s,\"paused\":%s,\"queued\":%u,"
+                  "\"wpm\":%u,\"mwpm\":%u,\"typed\":%u,\"chars\":%u}", first ? "" : ",", mac, (unsigned)(now - p.seenMs),
+                  JB(p.st.ble), JB(p.st.typing), JB(p.st.paused), p.st.queued, p.st.wpm, p.st.mwpm, (unsigned)p.st.typed, (unsigned)p.st.chars);
+    first = false;
+    if(p.st.typing){ typing++; mwpm += p.st.mwpm; }
+    typed += p.st.typed;
+  }
+  xSemaphoreGive(fleetLock);
+  snprintf(buf + n, sizeof(buf) - n, "],\"typing\":%u,\"mwpm\":%u,\"typed\":%u}", (unsigned)typing, (unsigned)mwpm, (unsigned)typed);
+  return reply(req, 200, "application/json", buf);
+}
 
-      bool alnum = ((c>='a'&&c<='z')||(c>='A'&&c<='Z')||(c>='0'&&c<='9'));
-      bool beginTypo = (!strict) && enableTypos && (random(0,100) < mistakePercent) && alnum && (mistakesCurrently < maxSimultaneousErrors);
-
-      if(beginTypo){
-        int len = clampInt(1 + random(0, typoMaxChars-1), 1, typoMaxChars);
-        if((N - i) < len) len = (N - i);
-        String wrong = createMistakeChunk(c, len);
-        sendCharsWithHold(wrong, holdMinMs, holdMaxMs);
-        logKeystroke(String("MISTAKE_SENT:") + wrong);
-        coopDelay(max(40, (int)nextDelay)); if(!typingActive) break;
-        for(int b=0;b<len && typingActive;++b){ sendBackspace(); coopDelay(random(20,60)); }
-        logKeystroke(String("MISTAKE_BS:") + String(len));
-        for(int r=0;r<len && typingActive;++r){ char rc = text[i + r]; sendChar(rc); int extraHold = random(holdMinMs, holdMaxMs+1); coopDelay((unsigned long)max((int)nextDelay/2, extraHold)); }
-        i += (len - 1);
-        mistakesCurrently++;
-      } else {
-        sendChar(c);
-        int extra = 0;
-        if(!strict){
-          if(isSpace) extra += random(40,140);
-          if(extraPunctPause && isPunct) extra += random(80,220);
-          if(c=='\n' || c=='\r') extra += random(120,320);
-        }
-        int hold = random(holdMinMs, holdMaxMs+1);
-        coopDelay((unsigned long)nextDelay + extra + hold);
-      }
+// POST /fleet/type?to=..[&plan=1] — the body is typed by the target workers (each filters it with its own config)
+esp_err_t handleFleetType(httpd_req_t *req){
+  QueryArgs args(req);
+  if(req->content_len == 0) return reply(req, 400, "text/plain", "Empty body");
+  if(req->content_len > TEXT_RING_SIZE) return reply(req, 413, "text/plain", "Too long for a fleet job");
+  UploadJob u = { NULL, 0, -1, NULL, args.toInt("plan") != 0, -1, fleetTargets(args) };
+  if(!u.fleet) return reply(req, 404, "text/plain", args.equals("to", "next") ? "No idle worker" : "No such worker");
+  bool idle = false;
+  if(!uploadBusy.compare_exchange_strong(idle, true)) return reply(req, 409, "text/plain", "Busy: upload in progress");
+  if(httpd_req_async_handler_begin(req, &u.req) != ESP_OK){ uploadBusy.store(false); return reply(req, 503, "text/plain", "Server busy"); }
+  xQueueSend(uploadQueue, &u, portMAX_DELAY); // never waits: one upload at a time (uploadBusy)
+  return ESP_OK;
+}
 
-      if(!strict && isSpace && thinkingSpaceChance>0 && (random(0,thinkingSpaceChance)==0)){
-        coopDelay(random(400,1000)); if(!typingActive) break;
-      }
+// Same command to every target; replies "<what> on n of m workers"
+static esp_err_t fleetFanOut(httpd_req_t *req, uint32_t targets, uint8_t type, const void *pl, size_t pn, const char *what){
+  int asked = 0, ok = 0;
+  for(int i=0;i<FLEET_MAX;i++) if(targets & (1u << i)){ asked++; if(fleetCall(i, type, pl, pn) == 200) ok++; }
+  char msg[64]; snprintf(msg, sizeof(msg), "%s on %d of %d workers", what, ok, asked);
+  return reply(req, asked && ok == asked ? 200 : asked ? 502 : 404, "text/plain", msg);
+}
+
+// GET /fleet/config?to=.. — push this board's live config (set it with /config first)
+esp_err_t handleFleetConfig(httpd_req_t *req){
+  QueryArgs args(req);
+  EngineConfig c = cfgSnapshot();
+  return fleetFanOut(req, fleetTargets(args), FL_CONFIG, &c, sizeof(c), "Config applied");
+}
+
+esp_err_t handleFleetStop(httpd_req_t *req){ QueryArgs args(req); return fleetFanOut(req, fleetTargets(args), FL_STOP, NULL, 0, "Stopped"); }
+
+// GET /fleet/pause?to=..&on=1|0
+esp_err_t handleFleetPause(httpd_req_t *req){
+  QueryArgs args(req);
+  uint8_t on = args.has("on") ? args.toInt("on") != 0 : 1;
+  return fleetFanOut(req, fleetTargets(args), FL_PAUSE, &on, 1, on ? "Paused" : "Resumed");
+}
+#endif
+
+// ---------------- Serial link ----------------
+// Jobs and control over the wire instead of Wi-Fi: a framed binary protocol on Serial (UART0 through the board's
+// USB bridge, or native USB-CDC when the core routes Serial there), so nothing on the host side shares the 2.4 GHz
+// front end with BLE. Built in with -DTYPIST_SERIAL_LINK=<baud> (e.g. 921600; the baud is ignored on USB-CDC); add
+// -DTYPIST_NO_WIFI to leave Wi-Fi off altogether and run the board from here alone. tools/serial_type.py is the host.
+//   frame: 0xA5 | type | len u16 | payload | CRC-16/CCITT-FALSE u16 over type, len and payload (little endian)
+// Host -> board, each answered with an SL_ACK {type, status i16, val u32} (status as the HTTP route would answer):
+//   SL_PING                -> val = SERIAL_PROTO_VERSION
+//   SL_STATUS              -> an SL_STATUS frame with the /status JSON instead of an ack
+//   SL_CONFIG "wpm=90&.."  -> the /config query string
+//   SL_BEGIN {len u32, plan u8} -> val = job id; like POST /type, streamed into textRing or queued
+//   SL_DATA {off u32, bytes}    -> val = bytes taken; acked once they're in, so the host sends one piece at a time
+//   SL_END                 -> val = bytes taken; 200 if the body was complete
+//   SL_STOP, SL_PAUSE {on u8}
+// The job's body goes through BodySink like an HTTP body. A piece that doesn't fit textRing yet waits beside the
+// parser, which keeps reading (SL_STOP still works), and is acked once the typer has made room. Bytes outside a
+// frame (boot messages, the sketch's own Serial prints) are skipped; a frame failing its CRC is dropped unacked
+// and the host resends it, and a resent piece that was already taken is simply acked again. The UART driver fills
+// its RX ring from the FIFO interrupt (Arduino exposes no UART DMA), so SERIAL_RX_BUF covers a whole piece.
+#if defined(TYPIST_SERIAL_LINK)
+#define SERIAL_PROTO_VERSION 1
+#define SERIAL_MAGIC 0xA5
+#define SERIAL_FRAME_MAX 1024       // payload bytes
+#define SERIAL_RX_BUF 4096          // UART driver RX ring
+#define SERIAL_POLL_MS 5            // while a piece waits for ring space, and on USB-CDC (no receive callback)
+#define SERIAL_JOB_IDLE_MS 10000    // an open job with no piece for this long is dropped (host gone)
+enum { SL_PING, SL_ACK, SL_STATUS, SL_CONFIG, SL_BEGIN, SL_DATA, SL_END, SL_STOP, SL_PAUSE };
+struct __attribute__((packed)) SerialAck { uint8_t type; int16_t status; uint32_t val; };
+
+TaskHandle_t serialTaskHandle = NULL;
+static uint8_t serialIn[4 + SERIAL_FRAME_MAX + 2];   // frame being assembled (serial task only, like the rest)
+static size_t serialHave = 0;
+static uint8_t serialOut[4 + SERIAL_FRAME_MAX + 2];
+static BodySink serialSink;
+static bool serialJobOpen = false;
+static uint32_t serialOff = 0, serialLen = 0, serialMs = 0;
+static uint8_t serialHeld[SERIAL_FRAME_MAX];         // the piece waiting for ring space
+static uint32_t serialHeldLen = 0, serialHeldOff = 0;
+
+static uint16_t crc16(const uint8_t *p, size_t n, uint16_t c = 0xffff){
+  while(n--){ c ^= (uint16_t)*p++ << 8; for(int i=0;i<8;i++) c = (c & 0x8000) ? (c << 1) ^ 0x1021 : c << 1; }
+  return c;
+}
+
+// One write call per frame, so the sketch's own prints can only land between frames
+static void serialSend(uint8_t type, const void *p, size_t n){
+  serialOut[0] = SERIAL_MAGIC; serialOut[1] = type; serialOut[2] = n & 0xff; serialOut[3] = n >> 8;
+  memcpy(serialOut + 4, p, n);
+  uint16_t c = crc16(serialOut + 1, 3 + n);
+  serialOut[4 + n] = c & 0xff; serialOut[5 + n] = c >> 8;
+  Serial.write(serialOut, 6 + n);
+}
+
+static void serialAck(uint8_t type, int16_t status, uint32_t val){ SerialAck a = { type, status, val }; serialSend(SL_ACK, &a, sizeof(a)); }
+
+// Run fn on the HTTP task, where job starts and config writes belong, and wait for it. False (nothing ran) before
+// the server is up. Without Wi-Fi this task is the only control plane and runs fn itself.
+#if defined(TYPIST_NO_WIFI)
+static bool serverRun(void (*fn)()){ fn(); return true; }
+#else
+static SemaphoreHandle_t serverRunDone = NULL;
+static void serverRunOn(void *arg){ ((void (*)())arg)(); xSemaphoreGive(serverRunDone); }
+static bool serverRun(void (*fn)()){
+  if(!httpServer || httpd_queue_work(httpServer, serverRunOn, (void*)fn) != ESP_OK) return false;
+  xSemaphoreTake(serverRunDone, portMAX_DELAY);
+  return true;
+}
+#endif
+
+// Arguments and results of the serverRun calls below (one at a time)
+static const uint8_t *runIn;
+static size_t runLen;
+static int runStatus;
+static uint32_t runVal;
+
+static void serialRunConfig(){ QueryArgs args((const char*)runIn, runLen); runStatus = configApply(args) ? 200 : 400; }
+
+static void serialRunBegin(){
+  uint32_t len; memcpy(&len, runIn, 4);
+  bool plan = runIn[4] != 0;
+  uint32_t id; int slot;
+  int st = len ? startTypeJob(len, id, slot, plan) : 400;
+  if(st > 1){ runStatus = st; return; }
+  sinkBegin(serialSink, slot, plan, NULL);
+  serialJobOpen = true; serialOff = 0; serialLen = len; serialMs = millis();
+  runStatus = 200; runVal = id;
+}
+
+// The held piece into the job once it fits (at once into a slot, or when the job was stopped and it's drained)
+static void serialFeedHeld(){
+  if(!serialHeldLen) return;
+  if(!serialSink.js && typingActive() && textRingFree() < serialHeldLen) return; // typer still catching up
+  bool ok = sinkPut(serialSink, serialHeld, serialHeldLen);
+  serialOff += serialHeldLen; serialHeldLen = 0; serialMs = millis();
+  serialAck(SL_DATA, ok ? 200 : 400, serialOff);
+}
+
+static void serialData(const uint8_t *p, size_t n){
+  if(n <= 4){ serialAck(SL_DATA, 400, serialOff); return; }
+  uint32_t off; memcpy(&off, p, 4);
+  p += 4; n -= 4;
+  if(!serialJobOpen){ serialAck(SL_DATA, 409, 0); return; }
+  if(serialHeldLen && off == serialHeldOff) return;                                 // resent while it waits: acked when taken
+  if(off + n <= serialOff){ serialAck(SL_DATA, 200, serialOff); return; }           // resent after its ack was lost
+  if(serialHeldLen || off != serialOff || off + n > serialLen){ serialAck(SL_DATA, 400, serialOff); return; }
+  memcpy(serialHeld, p, n); serialHeldLen = n; serialHeldOff = off;
+  serialFeedHeld();
+}
+
+static void serialEnd(bool complete){
+  sinkEnd(serialSink, complete);
+  serialJobOpen = false; serialHeldLen = 0;
+}
 
-      typedChars = i+1;
-      server.handleClient();
+static void serialFrame(uint8_t type, const uint8_t *p, size_t n){
+  static char json[sizeof(statusBuf)];
+  switch(type){
+    case SL_PING: serialAck(type, 200, SERIAL_PROTO_VERSION); break;
+    case SL_STATUS: statusJson(json, sizeof(json)); serialSend(SL_STATUS, json, strlen(json)); break;
+    case SL_CONFIG:
+      runIn = p; runLen = n;
+      serialAck(type, serverRun(serialRunConfig) ? runStatus : 503, 0);
+      break;
+    case SL_BEGIN:
+      if(n != 5){ serialAck(type, 400, 0); break; }
+      if(serialJobOpen){ serialAck(type, 409, 0); break; }
+      runIn = p; runVal = 0;
+      serialAck(type, serverRun(serialRunBegin) ? runStatus : 503, runVal);
+      break;
+    case SL_DATA: serialData(p, n); break;
+    case SL_END: {
+      if(!serialJobOpen || serialHeldLen){ serialAck(type, 409, serialOff); break; }
+      bool complete = serialOff == serialLen && !serialSink.badPlan;
+      serialEnd(complete);
+      serialAck(type, complete ? 200 : 400, serialOff);
+      break;
     }
+    case SL_STOP: requestStop(); serialAck(type, 200, 0); break;
+    case SL_PAUSE: setPaused(n ? p[0] != 0 : !isPaused()); serialAck(type, 200, isPaused()); break;
+    default: serialAck(type, 400, 0);
+  }
+}
 
-    typingActive = false;
-    paused = false; // clear paused state when finished
-    coopDelay(120 + random(0,300));
-    return;
+// Every complete frame in serialIn, keeping a partial one for the next read
+static void serialParse(){
+  size_t i = 0;
+  while(serialHave - i >= 6){
+    uint8_t *f = serialIn + i;
+    size_t len = f[2] | (f[3] << 8);
+    if(f[0] != SERIAL_MAGIC || len > SERIAL_FRAME_MAX){ i++; continue; }
+    if(serialHave - i < 6 + len) break;
+    if(crc16(f + 1, 3 + len) != (uint16_t)(f[4 + len] | (f[5 + len] << 8))){ i++; continue; } // resync past it
+    serialFrame(f[1], f + 4, len);
+    i += 6 + len;
   }
+  memmove(serialIn, serialIn + i, serialHave - i);
+  serialHave -= i;
 }
 
-// HTTP Handlers
-void handleRoot(){ server.send_P(200, "text/html", INDEX_HTML); }
-
-void handleStatus(){
-  String s = "{";
-  s += "\"ble\":" + String(bleKeyboard.isConnected()?"true":"false") + ",";
-  s += "\"wpm\":" + String(configuredWPM) + ",";
-  s += "\"strict\":" + String(strictWPM?"true":"false") + ",";
-  s += "\"jitter\":" + String(jitterStrengthPct) + ",";
-  s += "\"think\":" + String(thinkingSpaceChance) + ",";
-  s += "\"typos\":" + String(enableTypos?"true":"false") + ",";
-  s += "\"lpen\":" + String(enableLongPauses?"true":"false") + ",";
-  s += "\"lpmn\":" + String(longPauseMinMs) + ",";
-  s += "\"lpmx\":" + String(longPauseMaxMs) + ",";
-  s += "\"lpp\":" + String(longPausePercent) + ",";
-  s += "\"nl\":" + String(newlineMode) + ",";
-  s += "\"codemode\":" + String(codeMode?"true":"false") + ",";
-  s += "\"typed\":" + String((unsigned long)typedChars) + ",";
-  s += "\"running\":" + String(typingActive?"true":"false") + ",";
-  s += "\"paused\":" + String(paused?"true":"false") + ",";
-  s += "\"typoMax\":" + String(typoMaxChars) + ",";
-  s += "\"mistake\":" + String(mistakePercent) + ",";
-  s += "\"holdMin\":" + String(holdMinMs) + ",";
-  s += "\"holdMax\":" + String(holdMaxMs) + ",";
-  s += "\"state\":\"" + String(typingActive?"Typing...":"Ready.") + "\"";
-  s += "}";
-  server.send(200, "application/json", s);
-}
-
-void handleConfig(){
-  bool changed=false;
-  if(server.hasArg("wpm")){ configuredWPM = clampInt(server.arg("wpm").toInt(), 10, 300); changed=true; }
-  if(server.hasArg("strict")){ strictWPM = (server.arg("strict").toInt()!=0); changed=true; }
-  if(server.hasArg("jitter")){ jitterStrengthPct = clampInt(server.arg("jitter").toInt(), 5, 45); changed=true; }
-  if(server.hasArg("think")){ thinkingSpaceChance = clampInt(server.arg("think").toInt(), 0, 100); changed=true; }
-  if(server.hasArg("typos")){ enableTypos = (server.arg("typos").toInt()!=0); changed=true; }
-  if(server.hasArg("lpen")){ enableLongPauses = (server.arg("lpen").toInt()!=0); changed=true; }
-  if(server.hasArg("lpc")){ longPausePercent = clampInt(server.arg("lpc").toInt(), 0, 100); changed=true; }
-  if(server.hasArg("lpmin")){ longPauseMinMs = clampInt(server.arg("lpmin").toInt(), 50, 20000); changed=true; }
-  if(server.hasArg("lpmax")){ longPauseMaxMs = clampInt(server.arg("lpmax").toInt(), 50, 30000); changed=true; }
-  if(server.hasArg("nl")){ newlineMode = clampInt(server.arg("nl").toInt(), 0, 2); changed=true; }
-  if(server.hasArg("codemode")){ codeMode = (server.arg("codemode").toInt()!=0); changed=true; }
+static void serialRxCb(){ if(serialTaskHandle) xTaskNotifyGive(serialTaskHandle); }
+
+// Serial task (core 0): reads whatever the driver has, runs the complete frames, retries a held piece
+void serialTask(void *arg){
+  for(;;){
+    bool poll = serialHeldLen != 0;
+#if ARDUINO_USB_CDC_ON_BOOT
+    poll = true;
+#endif
+    ulTaskNotifyTake(pdTRUE, poll ? pdMS_TO_TICKS(SERIAL_POLL_MS) : pdMS_TO_TICKS(SERIAL_JOB_IDLE_MS / 4));
+    int n;
+    while((n = Serial.available()) > 0){
+      size_t room = sizeof(serialIn) - serialHave;
+      serialHave += Serial.readBytes(serialIn + serialHave, std::min((size_t)n, room));
+      serialParse(); // a full buffer always holds a complete frame or a skipped byte, so there's room again
+    }
+    serialFeedHeld();
+    if(serialJobOpen && !serialHeldLen && millis() - serialMs > SERIAL_JOB_IDLE_MS) serialEnd(false);
+  }
+}
 
-  // Pro knobs
-  if(server.hasArg("typoMax")){ typoMaxChars = clampInt(server.arg("typoMax").toInt(), 1, 6); changed=true; }
-  if(server.hasArg("mistake")){ mistakePercent = clampInt(server.arg("mistake").toInt(), 0, 100); changed=true; }
-  if(server.hasArg("holdMin")){ holdMinMs = clampInt(server.arg("holdMin").toInt(), 2, 1000); changed=true; }
-  if(server.hasArg("holdMax")){ holdMaxMs = clampInt(server.arg("holdMax").toInt(), 2, 2000); changed=true; }
-  if(holdMinMs > holdMaxMs){ int t = holdMinMs; holdMinMs = holdMaxMs; holdMaxMs = t; }
+// Before Serial.begin (the RX ring is sized there)
+void serialLinkBegin(){
+#if !defined(TYPIST_NO_WIFI)
+  serverRunDone = xSemaphoreCreateBinary();
+#endif
+  Serial.setRxBufferSize(SERIAL_RX_BUF);
+  Serial.begin(TYPIST_SERIAL_LINK);
+#if !ARDUINO_USB_CDC_ON_BOOT
+  Serial.onReceive(serialRxCb);
+#endif
+#if CONFIG_PM_ENABLE
+  // the UART stops in light sleep and would lose what arrives there; DFS only while the link is on
+  esp_pm_lock_handle_t awake;
+  if(esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "serial_link", &awake) == ESP_OK) esp_pm_lock_acquire(awake);
+#endif
+  xTaskCreatePinnedToCore(serialTask, "serial", 4096, NULL, 2, &serialTaskHandle, SERVER_CORE);
+}
+#endif
+
+esp_err_t handleStop(httpd_req_t *req){ requestStop(); return reply(req, 200, "text/plain", "Stop requested"); }
 
-  if(longPauseMinMs > longPauseMaxMs){ int t = longPauseMinMs; longPauseMinMs = longPauseMaxMs; longPauseMaxMs = t; }
-  server.send(changed?200:400, "text/plain", changed?"Config updated":"No changes");
+// toggle pause/resume while typing
+esp_err_t handlePause(httpd_req_t *req){
+  if(!typingActive()) return reply(req, 409, "text/plain", "Not typing");
+  setPaused(!isPaused());
+  return reply(req, 200, "text/plain", isPaused()?"Paused":"Resumed");
 }
 
-void handleType(){
-  if(typingActive){ server.send(409, "text/plain", "Busy: already typing"); return; }
-  String body = readRequestBody();
-  if(body.length()==0){ server.send(400, "text/plain", "Empty body"); return; }
-  if(!bleKeyboard.isConnected()){ server.send(503, "text/plain", "BLE not connected"); return; }
-  server.send(200, "text/plain", "Typing started (" + String(body.length()) + " chars)");
-  delay(10);
-  paused = false; // ensure not paused on new job
-  // run typing in-line (cooperative) — caller wanted single-file sketch. If you want true background thread,
-  // you can move typeLikeHuman to a dedicated task pinned to a core and return immediately.
-  typeLikeHuman(body);
+// Queued slots in run order: READY by `order`, then the one still uploading. Returns how many were written.
+static int poolOrder(int *idx){
+  int k = 0;
+  for(int i=0;i<JOB_POOL;i++){
+    if(jobPool[i].state.load() != SLOT_READY) continue;
+    int j = k++;
+    while(j > 0 && jobPool[idx[j-1]].order.load() > jobPool[i].order.load()){ idx[j] = idx[j-1]; j--; }
+    idx[j] = i;
+  }
+  for(int i=0;i<JOB_POOL;i++) if(jobPool[i].state.load() == SLOT_FILLING) idx[k++] = i;
+  return k;
 }
 
-void handleStop(){ typingActive = false; paused = false; server.send(200, "text/plain", "Stop requested"); }
+// GET /queue — {"running":id,"jobs":[{"id":..,"chars":..,"state":"ready"|"uploading"},...]} in run order
+esp_err_t handleQueue(httpd_req_t *req){
+  char buf[96 + JOB_POOL * 64];
+  int idx[JOB_POOL], k = poolOrder(idx);
+  size_t n = snprintf(buf, sizeof(buf), "{\"running\":%u,\"jobs\":[", (unsigned)runningJobId);
+  for(int j=0;j<k;j++){
+    const JobSlot &js = jobPool[idx[j]];
+    bool ready = js.state.load() == SLOT_READY;
+    n += snprintf(buf + n, sizeof(buf) - n, "%s{\"id\":%u,\"chars\":%u,\"state\":\"%s\"}", j ? "," : "",
+                  (unsigned)js.id, ready ? (unsigned)js.len : 0u, ready ? "ready" : "uploading");
+  }
+  snprintf(buf + n, sizeof(buf) - n, "]}");
+  return reply(req, 200, "application/json", buf);
+}
 
-// toggle pause/resume while typing
-void handlePause(){
-  if(!typingActive){ server.send(409, "text/plain", "Not typing"); return; }
-  paused = !paused;
-  server.send(200, "text/plain", paused?"Paused":"Resumed");
+// GET /queue/move?id=N&pos=P — move a queued job to position P (0 = runs next)
+esp_err_t handleQueueMove(httpd_req_t *req){
+  QueryArgs args(req);
+  int idx[JOB_POOL], k = poolOrder(idx), from = -1;
+  while(k > 0 && jobPool[idx[k-1]].state.load() != SLOT_READY) k--; // only READY jobs have an order
+  for(int j=0;j<k;j++) if(jobPool[idx[j]].id == (uint32_t)args.toInt("id")) from = j;
+  if(from < 0 || !args.has("pos")) return reply(req, 404, "text/plain", "No such queued job");
+  int to = clampInt(args.toInt("pos"), 0, k - 1);
+  uint32_t base = jobPool[idx[0]].order.load();
+  int moved = idx[from];
+  for(int j=from;j<k-1;j++) idx[j] = idx[j+1];
+  for(int j=k-1;j>to;j--) idx[j] = idx[j-1];
+  idx[to] = moved;
+  for(int j=0;j<k;j++) jobPool[idx[j]].order.store(base + j); // orders stay below jobOrderNext
+  return reply(req, 200, "text/plain", "Moved");
+}
+
+// GET /queue/cancel?id=N — drop a queued job (id=all drops every queued job); the running job is stopped instead
+esp_err_t handleQueueCancel(httpd_req_t *req){
+  QueryArgs args(req);
+  bool all = args.equals("id", "all");
+  uint32_t id = (uint32_t)args.toInt("id");
+  int dropped = 0;
+  for(JobSlot &js : jobPool){
+    uint8_t ready = SLOT_READY;
+    if((all || js.id == id) && js.state.compare_exchange_strong(ready, SLOT_FREE)) dropped++;
+  }
+  if(!all && !dropped && id && id == runningJobId){ requestStop(); return reply(req, 200, "text/plain", "Stop requested"); }
+  if(!all && !dropped) return reply(req, 404, "text/plain", "No such queued job");
+  char msg[32]; snprintf(msg, sizeof(msg), "Cancelled %d job(s)", dropped);
+  return reply(req, 200, "text/plain", msg);
+}
+
+// GET /profile — {"active":n,"profiles":[{"id":1,"name":".."},...]} (stored slots only; active 0 = custom)
+esp_err_t handleProfiles(httpd_req_t *req){
+  char buf[48 + PROFILE_SLOTS * 40];
+  size_t n = snprintf(buf, sizeof(buf), "{\"active\":%d,\"profiles\":[", (int)profile);
+  bool first = true;
+  for(int i=1;i<=PROFILE_SLOTS;i++){
+    if(!profiles[i].version) continue;
+    n += snprintf(buf + n, sizeof(buf) - n, "%s{\"id\":%d,\"name\":\"%.15s\"}", first ? "" : ",", i, profiles[i].name);
+    first = false;
+  }
+  snprintf(buf + n, sizeof(buf) - n, "]}");
+  return reply(req, 200, "application/json", buf);
+}
+
+// GET /profile/save?id=N&name=..  — store the live config in slot N (1..PROFILE_SLOTS) and select it
+esp_err_t handleProfileSave(httpd_req_t *req){
+  QueryArgs args(req);
+  int id = args.toInt("id");
+  if(id < 1 || id > PROFILE_SLOTS) return reply(req, 400, "text/plain", "Bad profile id");
+  if(typingActive()) return reply(req, 409, "text/plain", "Busy: typing");
+  char name[16] = "";
+  if(!args.text("name", name, sizeof(name)) || !name[0]) snprintf(name, sizeof(name), "Profile %d", id);
+  ProfileBlob b; profilePack(cfgSnapshot(), name, b);
+  profileWrite(id, b);
+  profile = id; cfgChanged();
+  return reply(req, 200, "text/plain", "Profile saved");
+}
+
+// GET /profile/load?id=N — make slot N the live config (RAM only, a running job picks it up at its next word)
+esp_err_t handleProfileLoad(httpd_req_t *req){
+  QueryArgs args(req);
+  int id = args.toInt("id");
+  if(id < 1 || id > PROFILE_SLOTS || !profiles[id].version) return reply(req, 404, "text/plain", "No such profile");
+  EngineConfig c = cfgSnapshot();
+  profileUnpack(profiles[id], c);
+  cfgPublish(c);
+  profile = id; cfgChanged();
+  return reply(req, 200, "text/plain", "Profile loaded");
+}
+
+// GET /profile/delete?id=N
+esp_err_t handleProfileDelete(httpd_req_t *req){
+  QueryArgs args(req);
+  int id = args.toInt("id");
+  if(id < 1 || id > PROFILE_SLOTS || !profiles[id].version) return reply(req, 404, "text/plain", "No such profile");
+  if(typingActive()) return reply(req, 409, "text/plain", "Busy: typing");
+  char k[4]; profileKey(id, k);
+  prefs.remove(k);
+  profiles[id] = {};
+  if(profile == id){ profile = 0; cfgChanged(); }
+  return reply(req, 200, "text/plain", "Profile deleted");
+}
+
+// GET /boot — {"setup":us,...,"bleConnected":us} esp_timer µs of each boot checkpoint (0 = not reached yet)
+esp_err_t handleBoot(httpd_req_t *req){
+  char buf[BOOT_JSON_MAX];
+  bootJson(buf, sizeof(buf));
+  return reply(req, 200, "application/json", buf);
+}
+
+// GET /snippets — {"bytes":..,"budget":..,"snippets":[{"id":"1a2b3c4d","chars":..,"code":..,"uses":..},...]}
+esp_err_t handleSnippets(httpd_req_t *req){
+  char buf[96 + SNIPPET_MAX * 80];
+  xSemaphoreTake(snippetLock, portMAX_DELAY);
+  size_t n = snprintf(buf, sizeof(buf), "{\"bytes\":%u,\"budget\":%u,\"snippets\":[", (unsigned)snippetBytes, (unsigned)snippetArenaSize);
+  bool first = true;
+  for(const Snippet &e : snippets){
+    if(!e.id) continue;
+    n += snprintf(buf + n, sizeof(buf) - n, "%s{\"id\":\"%08x\",\"chars\":%u,\"code\":%s,\"uses\":%u}", first ? "" : ",",
+                  (unsigned)e.id, (unsigned)e.len, e.code ? "true" : "false", (unsigned)e.uses);
+    first = false;
+  }
+  xSemaphoreGive(snippetLock);
+  snprintf(buf + n, sizeof(buf) - n, "]}");
+  return reply(req, 200, "application/json", buf);
+}
+
+// GET /snippets/delete?id=<id> (id=all empties the cache)
+esp_err_t handleSnippetDelete(httpd_req_t *req){
+  QueryArgs args(req);
+  bool all = args.equals("id", "all");
+  uint32_t id = args.toHex("id");
+  int dropped = 0;
+  xSemaphoreTake(snippetLock, portMAX_DELAY);
+  bool staging = snippetStaging;
+  if(!staging) for(Snippet &e : snippets) if(e.id && (all || e.id == id)){ snippetDrop(e); dropped++; }
+  xSemaphoreGive(snippetLock);
+  if(staging) return reply(req, 409, "text/plain", "Busy: upload in progress");
+  if(!all && !dropped) return reply(req, 404, "text/plain", "No such snippet");
+  char msg[32]; snprintf(msg, sizeof(msg), "Deleted %d snippet(s)", dropped);
+  return reply(req, 200, "text/plain", msg);
+}
+
+// Stream the keystroke log without building it in memory: a fixed scratch buffer is flushed as HTTP chunks.
+// JSON rows are [tUs, type, charCode, holdUs, ikiUs]; ?format=bin sends packed LogEntry structs instead,
+// ?since=<seq> returns only entries newer than a previous response's "seq".
+esp_err_t handleLog(httpd_req_t *req){
+  static char buf[1024];
+  QueryArgs args(req);
+  bool bin = args.equals("format", "bin");
+  uint32_t end = logSeq.load(std::memory_order_acquire);
+  uint32_t start = (end >= MAX_LOG_ENTRIES) ? end - (MAX_LOG_ENTRIES - 1) : 0;
+  if(args.has("since")){ uint32_t since = (uint32_t)args.toInt("since"); if(since > start && since <= end) start = since; }
+
+  httpd_resp_set_type(req, bin ? "application/octet-stream" : "application/json");
+  size_t n = 0;
+  if(!bin) n = snprintf(buf, sizeof(buf), "{\"seq\":%u,\"fields\":[\"t\",\"type\",\"ch\",\"hold\",\"iki\"],\"events\":[", (unsigned)end);
+  bool first = true;
+  for(uint32_t i = start; i < end; i++){
+    LogEntry e;
+    if(!logRead(i, e)) continue;
+    if(bin){ memcpy(buf + n, &e, sizeof(e)); n += sizeof(e); }
+    else n += snprintf(buf + n, sizeof(buf) - n, "%s[%u,%u,%u,%u,%u]", first ? "" : ",",
+                       (unsigned)e.tUs, (unsigned)e.type, (unsigned)(uint8_t)e.ch, (unsigned)e.holdUs, (unsigned)e.delayUs);
+    first = false;
+    if(n > sizeof(buf) - 64){ if(httpd_resp_send_chunk(req, buf, n) != ESP_OK) return ESP_FAIL; n = 0; }
+  }
+  if(!bin) n += snprintf(buf + n, sizeof(buf) - n, "]}");
+  if(n && httpd_resp_send_chunk(req, buf, n) != ESP_OK) return ESP_FAIL;
+  return httpd_resp_send_chunk(req, NULL, 0);
 }
 
-void handleLog(){
-  // return last N log entries as text
-  String out = "";
-  int start = (logHead - logCount + MAX_LOG_ENTRIES) % MAX_LOG_ENTRIES;
-  for(int i=0;i<logCount;i++){
-    int idx = (start + i) % MAX_LOG_ENTRIES;
-    out += keystrokeLog[idx] + "\n";
+// GET /bench/rng — per-sample cost of the IKI model: the old libm path (random() + Box-Muller + logf/expf)
+// vs the table-driven sampler, plus the normal's sample moments as a sanity check. Runs on the server task.
+esp_err_t handleBenchRng(httpd_req_t *req){
+  const int N = 10000;
+  const float mean = 40.0f, sigma = 0.7f;
+  FastRng r; r.seed(esp_random());
+  LogNormalSampler iki; iki.setSigma(sigma);
+  volatile float sink = 0;
+
+  int64_t t0 = esp_timer_get_time();
+  for(int k=0;k<N;k++){
+    float u1 = random(1, 16777217) / 16777216.0f, u2 = random(1, 16777217) / 16777216.0f;
+    float z = sqrtf(-2.0f * logf(u1)) * cosf(2.0f * PI * u2);
+    sink = sink + expf(logf(mean) - 0.5f * sigma * sigma + sigma * z);
+  }
+  int64_t t1 = esp_timer_get_time();
+  for(int k=0;k<N;k++) sink = sink + iki.sample(r, ziggurat, mean);
+  int64_t t2 = esp_timer_get_time();
+  double sum = 0, sum2 = 0;
+  for(int k=0;k<N;k++){ float z = ziggurat.sample(r); sum += z; sum2 += (double)z * z; }
+  int64_t t3 = esp_timer_get_time();
+  for(int k=0;k<N;k++) sink = sink + (float)r.range(0, 1000);
+  int64_t t4 = esp_timer_get_time();
+  (void)sink;
+
+  double zMean = sum / N;
+  char buf[256];
+  snprintf(buf, sizeof(buf),
+    "{\"n\":%d,\"libm_ns\":%u,\"lognormal_ns\":%u,\"normal_ns\":%u,\"uniform_ns\":%u,\"z_mean\":%.4f,\"z_var\":%.4f}",
+    N, (unsigned)((t1 - t0) * 1000 / N), (unsigned)((t2 - t1) * 1000 / N), (unsigned)((t3 - t2) * 1000 / N),
+    (unsigned)((t4 - t3) * 1000 / N), zMean, sum2 / N - zMean * zMean);
+  return reply(req, 200, "application/json", buf);
+}
+
+// GET /bench — results of the last engine bench. /bench?run=1[&wpm=60,120,200,300][&code=0,1][&chars=200] starts one
+// on the typer (needs it idle, not BLE); rows appear as they finish and /stop ends the run early.
+esp_err_t handleBench(httpd_req_t *req){
+  QueryArgs args(req);
+  if(args.toInt("run")){
+    if(bench.state.load() == 1) return reply(req, 409, "text/plain", "Bench already running");
+    int idle = 0;
+    if(!ringRefs.compare_exchange_strong(idle, 1)) return reply(req, 409, "text/plain", "Busy: typing");
+    char list[48];
+    uint16_t wpms[BENCH_MAX_ROWS]; int nw = 0;
+    if(args.text("wpm", list, sizeof(list))){
+      for(char *p = list; *p && nw < BENCH_MAX_ROWS; ){ wpms[nw++] = clampInt(atoi(p), 10, 300); while(*p && *p != ',') p++; if(*p) p++; }
+    }
+    if(!nw){ const uint16_t def[] = { 60, 120, 200, 300 }; for(uint16_t w : def) wpms[nw++] = w; }
+    bool codes[2]; int nc = 0;
+    if(!args.has("code") || args.equals("code", "0,1")){ codes[nc++] = false; codes[nc++] = true; }
+    else codes[nc++] = args.toInt("code") != 0;
+    bench.rows = 0;
+    for(int ci=0;ci<nc;ci++) for(int wi=0;wi<nw && bench.rows < BENCH_MAX_ROWS;wi++){ bench.wpm[bench.rows] = wpms[wi]; bench.code[bench.rows++] = codes[ci]; }
+    bench.chars = args.has("chars") ? clampInt(args.toInt("chars"), 20, TEXT_RING_SIZE) : 200;
+    bench.done = 0;
+    bench.state.store(1);
+    xEventGroupClearBits(typerEvents, EVT_STOP);
+    xEventGroupSetBits(typerEvents, EVT_TYPING | EVT_RESUME);
+    TypeJob job = { 0, BENCH_JOB_ID };
+    if(xQueueSend(jobQueue, &job, 0) != pdTRUE){
+      xEventGroupClearBits(typerEvents, EVT_TYPING); bench.state.store(0); ringRelease();
+      return reply(req, 503, "text/plain", "Typer not ready");
+    }
+    char msg[48]; snprintf(msg, sizeof(msg), "Bench started (%u rows)", (unsigned)bench.rows);
+    return reply(req, 200, "text/plain", msg);
+  }
+  static const char *const STATE[] = { "idle", "running", "done" };
+  static char buf[160 + BENCH_MAX_ROWS * 200]; // server task only
+  uint8_t st = bench.state.load();
+  size_t n = snprintf(buf, sizeof(buf), "{\"state\":\"%s\",\"chars\":%u,\"heapFree\":%u,\"heapMin\":%u,\"stackFree\":%u,\"pm\":\"%s\",\"rows\":[",
+                      STATE[st], (unsigned)bench.chars, (unsigned)bench.heapFree, (unsigned)bench.heapMin, (unsigned)bench.stackFree,
+                      POWER_MODE_NAMES[powerMode]);
+  for(uint8_t i=0;i<bench.done;i++){
+    const BenchRow &b = bench.row[i];
+    n += snprintf(buf + n, sizeof(buf) - n,
+      "%s{\"wpm\":%u,\"code\":%s,\"chars\":%u,\"wpmAchieved\":%u,\"errP50\":%u,\"errP99\":%u,\"errMax\":%u,\"stalls\":%u,\"costAvg\":%u,\"costMax\":%u,"
+      "\"awake\":%.1f,\"mJper1k\":%.1f}",
+      i ? "," : "", b.wpm, b.code ? "true" : "false", (unsigned)b.chars, b.wpmAchieved, (unsigned)b.p50, (unsigned)b.p99,
+      (unsigned)b.errMax, (unsigned)b.stalls, (unsigned)b.costAvg, (unsigned)b.costMax, b.awakePermille / 10.0f, b.mJ1k);
   }
-  server.send(200, "text/plain", out);
+  snprintf(buf + n, sizeof(buf) - n, "]}");
+  return reply(req, 200, "application/json", buf);
+}
+
+// ---------------- Metrics export ----------------
+// GET /metrics — Prometheus text format: the engine's counters (engine.h), HTTP handler time, BLE drops and heap.
+// Everything is a counter or a gauge read at scrape time, so the keystroke log can stay off on fleet devices.
+std::atomic<uint32_t> httpRequests(0), httpBusyUs(0);  // all handlers, incl. the synchronous part of /type
+std::atomic<uint32_t> bleDrops(0);                     // connected -> disconnected, seen by statusTask
+static char metricsBuf[3584]; // server task only
+static size_t metricsLen;
+
+static void promf(const char *fmt, ...){
+  va_list ap; va_start(ap, fmt);
+  int n = vsnprintf(metricsBuf + metricsLen, sizeof(metricsBuf) - metricsLen, fmt, ap);
+  va_end(ap);
+  if(n > 0) metricsLen = std::min(metricsLen + n, sizeof(metricsBuf) - 1);
+}
+
+static void promMetric(const char *name, const char *type, const char *help, double v){
+  promf("# HELP typist_%s %s\n# TYPE typist_%s %s\ntypist_%s %.9g\n", name, help, name, type, name, v);
+}
+
+// Per-range buckets in b (n bounds in µs plus the overflow bucket) as a cumulative histogram in seconds
+static void promHistogram(const char *name, const char *help, const std::atomic<uint32_t> *b, const uint32_t *leUs, int n,
+                          uint32_t count, double sumS){
+  promf("# HELP typist_%s %s\n# TYPE typist_%s histogram\n", name, help, name);
+  uint32_t acc = 0;
+  for(int k=0;k<n;k++){ acc += b[k].load(std::memory_order_relaxed); promf("typist_%s_bucket{le=\"%g\"} %u\n", name, leUs[k] / 1e6, (unsigned)acc); }
+  acc += b[n].load(std::memory_order_relaxed);
+  promf("typist_%s_bucket{le=\"+Inf\"} %u\ntypist_%s_sum %.6f\ntypist_%s_count %u\n", name, (unsigned)acc, name, sumS, name, (unsigned)count);
+}
+
+esp_err_t handleMetrics(httpd_req_t *req){
+  metricsLen = 0;
+  promHistogram("iki_seconds", "Interval between consecutive key-downs", metrics.iki, METRIC_IKI_LE_US, METRIC_IKI_BUCKETS,
+                metrics.ikiCount.load(), metrics.ikiSumMs.load() / 1e3);
+  promHistogram("key_late_seconds", "Key-down time behind its scheduled deadline", metrics.late, METRIC_LATE_LE_US, METRIC_LATE_BUCKETS,
+                metrics.lateCount.load(), metrics.lateSumUs.load() / 1e6);
+  promMetric("player_work_seconds_total", "counter", "Player time outside deadline waits (planning, HID sends)", metrics.workUs.load() / 1e6);
+  promMetric("jobs_total", "counter", "Typing jobs started", metrics.jobs.load());
+  promMetric("chars_typed_total", "counter", "Source characters typed", metrics.chars.load());
+  promMetric("typo_keys_total", "counter", "Mistaken keystrokes", metrics.typos.load());
+  promMetric("backspaces_total", "counter", "Backspace keystrokes (typo corrections and typed backspaces)", metrics.backspaces.load());
+  promMetric("schedule_stalls_total", "counter", "Re-anchors after the player fell too far behind (BLE stall)", metrics.stalls.load());
+  promMetric("hid_lost_total", "counter", "Jobs cut short because BLE stayed down past the reconnect window", metrics.hidLost.load());
+  promMetric("hid_resumes_total", "counter", "Jobs resumed after a BLE reconnect", metrics.hidResumes.load());
+  promMetric("ble_disconnects_total", "counter", "BLE connection drops", bleDrops.load());
+  promMetric("ble_connected", "gauge", "BLE host connected", bleKeyboard.isConnected());
+  promMetric("typing", "gauge", "A job is running", typingActive());
+  promMetric("measured_wpm", "gauge", "Measured WPM of the current or last job", measuredWpm);
+  promMetric("http_requests_total", "counter", "HTTP requests handled", httpRequests.load());
+  promMetric("http_handler_seconds_total", "counter", "Time spent in HTTP handlers (server task, core 0)", httpBusyUs.load() / 1e6);
+  promMetric("heap_free_bytes", "gauge", "Free heap", ESP.getFreeHeap());
+  promMetric("heap_min_free_bytes", "gauge", "Lowest free heap since boot", ESP.getMinFreeHeap());
+  promMetric("heap_max_alloc_bytes", "gauge", "Largest allocatable heap block", ESP.getMaxAllocHeap());
+  promMetric("uptime_seconds", "gauge", "Time since boot", esp_timer_get_time() / 1e6);
+  return reply(req, 200, "text/plain; version=0.0.4", metricsBuf, metricsLen);
+}
+
+// Every route runs through here so /metrics can report the server's own cost; user_ctx holds the real handler
+static esp_err_t timedRoute(httpd_req_t *req){
+  int64_t t0 = esp_timer_get_time();
+  esp_err_t r = ((esp_err_t (*)(httpd_req_t*))req->user_ctx)(req);
+  metricAdd(httpRequests); metricAdd(httpBusyUs, (uint32_t)(esp_timer_get_time() - t0));
+  return r;
+}
+
+// ---------------- Live status (SSE) ----------------
+// GET /events is a text/event-stream. While someone listens or a job runs, a periodic esp_timer wakes statusTask
+// every SSE_PERIOD_MS; otherwise the timer is off and statusTask only wakes every STATUS_IDLE_MS (BLE link poll,
+// config persist, fleet beacon), so an idle board can light-sleep in between. On each tick it sends
+// only the fields that changed — {"t":typed,"s":0 ready/1 typing/2 paused,"w":measured WPM,"e":approx. ETA ms,
+// "n":job chars,"b":BLE,"q":queued jobs} — to every listener from one static buffer. Nothing is allocated
+// per push, and the typer never touches a socket.
+#define SSE_MAX_CLIENTS 3
+#define SSE_PERIOD_MS 200       // at most 5 pushes/s
+#define SSE_KEEPALIVE_MS 15000  // comment line so proxies and browsers keep an idle stream open
+#define STATUS_IDLE_MS 1000     // statusTask period while the SSE timer is off
+struct LiveStatus { uint32_t typed, eta, n; uint16_t wpm; uint8_t state, ble, queued; };
+httpd_req_t *sseClients[SSE_MAX_CLIENTS]; // detached requests, owned by statusTask
+LiveStatus sseLast = {};
+static char sseBuf[160];
+static uint32_t sseLastSendMs = 0;
+esp_timer_handle_t sseTimer = nullptr;
+static bool sseTicking = false;  // statusTask only
+void sseTimerCb(void *arg){ if(statusTaskHandle) xTaskNotifyGive(statusTaskHandle); }
+
+static LiveStatus liveSnapshot(){
+  LiveStatus s;
+  uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
+  s.typed = typedChars; s.n = jobChars; s.ble = bleKeyboard.isConnected();
+  s.queued = poolCount(SLOT_READY) + poolCount(SLOT_FILLING);
+  s.state = !typingActive() ? 0 : isPaused() ? 2 : 1;
+  long eta = s.state ? (long)(jobEndMs - now) : 0;
+  s.eta = eta > 0 ? (uint32_t)eta : 0;
+  s.wpm = measuredWpm;
+  return s;
+}
+
+// "data: {...}\n\n" with the fields of s that differ from prev (all of them if prev is null); 0 if none do
+static size_t liveFormat(char *b, size_t cap, const LiveStatus &s, const LiveStatus *prev){
+  size_t n = snprintf(b, cap, "data: {");
+  const size_t empty = n;
+  auto field = [&](const char *key, uint32_t v, bool changed){
+    if(changed) n += snprintf(b + n, cap - n, "%s\"%s\":%u", n > empty ? "," : "", key, (unsigned)v);
+  };
+  field("t", s.typed, !prev || prev->typed != s.typed);
+  field("s", s.state, !prev || prev->state != s.state);
+  field("w", s.wpm, !prev || prev->wpm != s.wpm);
+  field("e", s.eta, !prev || prev->eta != s.eta);
+  field("n", s.n, !prev || prev->n != s.n);
+  field("b", s.ble, !prev || prev->ble != s.ble);
+  field("q", s.queued, !prev || prev->queued != s.queued);
+  if(n == empty) return 0;
+  n += snprintf(b + n, cap - n, "}\n\n");
+  return n;
+}
+
+// Send the pending delta (or a full snapshot) to every listener, dropping ones whose socket went away.
+// Returns whether anyone is still listening.
+bool ssePush(bool full){
+  int listeners = 0;
+  for(httpd_req_t *c : sseClients) if(c) listeners++;
+  if(!listeners) return false;
+  LiveStatus s = liveSnapshot();
+  uint32_t now = millis();
+  size_t n = liveFormat(sseBuf, sizeof(sseBuf), s, full ? nullptr : &sseLast);
+  if(!n){
+    if(now - sseLastSendMs < SSE_KEEPALIVE_MS) return true;
+    n = snprintf(sseBuf, sizeof(sseBuf), ":\n\n");
+  }
+  sseLast = s; sseLastSendMs = now;
+  for(httpd_req_t *&c : sseClients){
+    if(c && httpd_resp_send_chunk(c, sseBuf, n) != ESP_OK){ httpd_req_async_handler_complete(c); c = NULL; listeners--; }
+  }
+  return listeners > 0;
+}
+
+// Take listeners handed over by handleEvents; everyone gets a full snapshot so deltas stay in sync
+static bool sseAdmit(){
+  bool joined = false;
+  httpd_req_t *req;
+  while(xQueueReceive(sseJoinQueue, &req, 0) == pdTRUE){
+    int slot = -1;
+    for(int i=0;i<SSE_MAX_CLIENTS;i++) if(!sseClients[i]){ slot = i; break; }
+    if(slot < 0){ reply(req, 503, "text/plain", "Too many listeners"); httpd_req_async_handler_complete(req); continue; }
+    httpd_resp_set_type(req, "text/event-stream");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    if(httpd_resp_send_chunk(req, "retry: 2000\n\n", HTTPD_RESP_USE_STRLEN) != ESP_OK){ httpd_req_async_handler_complete(req); continue; }
+    sseClients[slot] = req;
+    joined = true;
+  }
+  return joined;
+}
+
+// GET /events — detach the request and let statusTask own the stream
+esp_err_t handleEvents(httpd_req_t *req){
+  httpd_req_t *detached = NULL;
+  if(httpd_req_async_handler_begin(req, &detached) != ESP_OK) return reply(req, 503, "text/plain", "Too many listeners");
+  if(xQueueSend(sseJoinQueue, &detached, 0) != pdTRUE){
+    reply(detached, 503, "text/plain", "Too many listeners");
+    return httpd_req_async_handler_complete(detached);
+  }
+  xTaskNotifyGive(statusTaskHandle);
+  return ESP_OK;
+}
+
+// Status task (core 0): admits new listeners and pushes deltas on every sseTimer tick; the timer only runs while
+// there is someone to tell or a job to report on (startTypeJob and handleEvents wake this task to start it)
+void statusTask(void *arg){
+  for(;;){
+    ulTaskNotifyTake(pdTRUE, sseTicking ? portMAX_DELAY : pdMS_TO_TICKS(STATUS_IDLE_MS));
+    bool listening = ssePush(sseAdmit());
+    bool tick = listening || typingActive() || uploadBusy.load() || poolCount(SLOT_READY);
+    if(tick != sseTicking){
+      if(tick) esp_timer_start_periodic(sseTimer, SSE_PERIOD_MS * 1000ULL); else esp_timer_stop(sseTimer);
+      sseTicking = tick;
+    }
+    cfgPersistIfIdle(typingActive() || uploadBusy.load());
+    if(bleLinkPoll()) metricAdd(bleDrops); // also drops to slow advertising once the reconnect window has passed
+#if defined(TYPIST_FLEET_KEY)
+    fleetBeacon();
+#endif
+  }
+}
+
+// Typer side: load the next READY slot into textRing (the caller holds the ring). False if nothing is queued.
+static bool poolStart(TypeJob &job){
+  for(;;){
+    int i = poolPeek();
+    if(i < 0) return false;
+    JobSlot &js = jobPool[i];
+    uint8_t ready = SLOT_READY;
+    if(!js.state.compare_exchange_strong(ready, SLOT_TAKEN)) continue; // cancelled (or reordered) meanwhile
+    memcpy(textRing.buf, js.text, js.len);
+    textRing.rd.store(0); textRing.wr.store(js.len);
+    textRing.expected = js.len; textRing.code = js.code; textRing.plan = js.plan;
+    textRing.eof.store(true, std::memory_order_release);
+    job.expected = js.len; job.id = js.id;
+    js.state.store(SLOT_FREE, std::memory_order_release);
+    xEventGroupClearBits(typerEvents, EVT_STOP);
+    xEventGroupSetBits(typerEvents, EVT_TYPING | EVT_RESUME);
+    return true;
+  }
+}
+
+// Typer task (core 1): runs streamed jobs from jobQueue and, whenever the ring is free, queued slots back to back
+void typerTask(void *arg){
+  for(;;){
+    TypeJob job;
+    int idle = 0;
+    bool queued = false;
+    if(bleKeyboard.isConnected() && ringRefs.compare_exchange_strong(idle, 1)){
+      queued = poolStart(job);
+      if(!queued) ringRefs.store(0);
+    }
+    if(!queued){
+      // queued jobs wait here while BLE is down, so poll for the reconnect
+      TickType_t wait = poolCount(SLOT_READY) ? pdMS_TO_TICKS(500) : portMAX_DELAY;
+      if(xQueueReceive(jobQueue, &job, wait) != pdTRUE || job.id == 0) continue; // wake-up: look at the pool again
+    }
+    runningJobId = job.id == BENCH_JOB_ID ? 0 : job.id;
+    ulTaskNotifyTake(pdTRUE, 0); // drop wakeups left over from the previous job
+    powerHold(true);
+    if(job.id == BENCH_JOB_ID) benchRun(); else typeLikeHuman<FeaturesPro>(job.expected);
+    powerHold(false);
+    if(docFeed.doc >= 0 && job.id == docFeed.jobId) docJobEnded(typedChars);
+    runningJobId = 0;
+    xEventGroupClearBits(typerEvents, EVT_TYPING | EVT_STOP);
+    xEventGroupSetBits(typerEvents, EVT_RESUME); // clear paused state when finished
+    ringRefs.fetch_sub(1);
+  }
+}
+
+// Start esp_http_server on core 0 and register every route
+void httpBegin(){
+  static const httpd_uri_t routes[] = {
+    { "/",          HTTP_GET,  handleRoot,     NULL },
+    { "/status",    HTTP_GET,  handleStatus,   NULL },
+    { "/config",    HTTP_GET,  handleConfig,   NULL },
+    { "/livewpm",   HTTP_GET,  handleLiveWpm,  NULL },
+    { "/type",      HTTP_POST, handleType,     NULL }, // body streamed into textRing by uploadTask
+    { "/stop",      HTTP_GET,  handleStop,     NULL },
+    { "/pause",     HTTP_GET,  handlePause,    NULL }, // pause/resume endpoint
+    { "/queue",     HTTP_GET,  handleQueue,    NULL },
+    { "/queue/move", HTTP_GET, handleQueueMove, NULL },
+    { "/queue/cancel", HTTP_GET, handleQueueCancel, NULL },
+    { "/profile",   HTTP_GET,  handleProfiles, NULL },
+    { "/profile/save", HTTP_GET, handleProfileSave, NULL },
+    { "/profile/load", HTTP_GET, handleProfileLoad, NULL },
+    { "/profile/delete", HTTP_GET, handleProfileDelete, NULL },
+    { "/snippets",  HTTP_GET,  handleSnippets, NULL },
+    { "/snippets/delete", HTTP_GET, handleSnippetDelete, NULL },
+    { "/docs",      HTTP_GET,  handleDocs,     NULL },
+    { "/docs",      HTTP_POST, handleDocPut,   NULL }, // body stored by uploadTask
+    { "/docs/delete", HTTP_GET, handleDocDelete, NULL },
+    { "/log",       HTTP_GET,  handleLog,      NULL },
+    { "/events",    HTTP_GET,  handleEvents,   NULL },
+    { "/bench",     HTTP_GET,  handleBench,    NULL },
+    { "/bench/rng", HTTP_GET,  handleBenchRng, NULL },
+    { "/boot",      HTTP_GET,  handleBoot,     NULL },
+    { "/metrics",   HTTP_GET,  handleMetrics,  NULL },
+#if defined(TYPIST_FLEET_KEY)
+    { "/fleet",     HTTP_GET,  handleFleet,    NULL },
+    { "/fleet/type", HTTP_POST, handleFleetType, NULL }, // body passed on by uploadTask
+    { "/fleet/config", HTTP_GET, handleFleetConfig, NULL },
+    { "/fleet/stop", HTTP_GET, handleFleetStop, NULL },
+    { "/fleet/pause", HTTP_GET, handleFleetPause, NULL },
+#endif
+  };
+  httpd_config_t cfg = HTTPD_DEFAULT_CONFIG();
+  cfg.core_id = SERVER_CORE;
+  cfg.task_priority = 2;
+  cfg.stack_size = 6144;
+  cfg.max_uri_handlers = sizeof(routes) / sizeof(routes[0]);
+  cfg.lru_purge_enable = true;   // a new client may evict the least recently used idle socket
+  cfg.recv_wait_timeout = 2;     // seconds; a stalled client only holds its own socket this long
+  cfg.send_wait_timeout = 2;
+  if(httpd_start(&httpServer, &cfg) != ESP_OK){ Serial.println("HTTP server failed to start"); return; }
+  for(const httpd_uri_t &r : routes){
+    httpd_uri_t u = r;
+    u.handler = timedRoute; u.user_ctx = (void*)r.handler;
+    httpd_register_uri_handler(httpServer, &u);
+  }
+}
+
+// Wi-Fi soft-AP and HTTP server, started by bootNetBegin() while setup() brings BLE up
+void netStart(){
+  WiFi.mode(WIFI_AP);
+#if defined(TYPIST_FLEET_KEY)
+  WiFi.softAP(AP_SSID, AP_PASS, FLEET_CHANNEL);
+#else
+  WiFi.softAP(AP_SSID, AP_PASS);
+#endif
+  bootMark(BOOT_AP);
+  httpBegin();
+  bootMark(BOOT_HTTP);
+#if defined(TYPIST_FLEET_KEY)
+  fleetBegin();
+#endif
+  Serial.println("Server ready. Open http://" + WiFi.softAPIP().toString());
 }
 
 // Setup / Loop
 void setup(){
+  bootMark(BOOT_SETUP);
+#if defined(TYPIST_SERIAL_LINK)
+  serialLinkBegin();
+#else
   Serial.begin(115200);
-  delay(100);
+#endif
   randomSeed(esp_random());
-  Serial.println("Starting BLE...");
+  espEngineBegin(&espIo);
+  profilesBegin(); // saved config is live before anything can connect
+  snippetsBegin();
+  docsBegin();
+  bootMark(BOOT_CONFIG);
+
+  jobQueue = xQueueCreate(JOB_POOL + 4, sizeof(TypeJob)); // one streamed job plus pool wake-ups
+  uploadQueue = xQueueCreate(1, sizeof(UploadJob));
+  sseJoinQueue = xQueueCreate(SSE_MAX_CLIENTS, sizeof(httpd_req_t*));
+  esp_timer_create_args_t sseArgs = {};
+  sseArgs.callback = sseTimerCb;
+  sseArgs.name = "sse_tick";
+  esp_timer_create(&sseArgs, &sseTimer);
+  uiInit();
+  xTaskCreatePinnedToCore(typerTask, "typer", 8192, NULL, 3, &typerTaskHandle, TYPER_CORE);
+  xTaskCreatePinnedToCore(uploadTask, "upload", 4096, NULL, 2, &uploadTaskHandle, SERVER_CORE);
+  xTaskCreatePinnedToCore(statusTask, "status", 4096, NULL, 1, &statusTaskHandle, SERVER_CORE);
+  xTaskCreatePinnedToCore(docTask, "docs", 4096, NULL, 2, &docTaskHandle, SERVER_CORE);
+
+  // the two radios come up in parallel: Wi-Fi + HTTP in bootNetBegin()'s task, BLE here
+#if defined(TYPIST_NO_WIFI)
+  WiFi.mode(WIFI_OFF); // serial link only
+  bootStepDone();
+#else
+  bootNetBegin(netStart);
+#endif
+#if !defined(USE_NIMBLE)
+  BLEDevice::setCustomGattsHandler(bleGattsHook);
+#endif
   bleKeyboard.begin();
-  delay(200);
-
-  Serial.println("Starting Wi-Fi AP...");
-  WiFi.mode(WIFI_AP);
-  WiFi.softAP(AP_SSID, AP_PASS);
-  IPAddress ip = WiFi.softAPIP();
-  Serial.print("AP IP: "); Serial.println(ip);
-
-  server.on("/", HTTP_GET, handleRoot);
-  server.on("/status", HTTP_GET, handleStatus);
-  server.on("/config", HTTP_GET, handleConfig);
-  server.on("/type", HTTP_POST, handleType);
-  server.on("/stop", HTTP_GET, handleStop);
-  server.on("/pause", HTTP_GET, handlePause); // pause/resume endpoint
-  server.on("/log", HTTP_GET, handleLog);
-
-  server.begin();
-  Serial.println("Server ready. Open http://" + WiFi.softAPIP().toString());
-  Serial.println("Pair your target device to BLE name shown in console.");
+  bootMark(BOOT_BLE);
+  Serial.println("BLE advertising. Pair your target device to the BLE name shown in console.");
+  bootStepDone();
 }
 
-void loop(){ server.handleClient(); }
+// All work happens in the typer, upload and status tasks and the HTTP server's own task; free the Arduino loop task
+void loop(){ vTaskDelete(NULL); }
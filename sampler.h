@@ -0,0 +1,118 @@
+/*
+  sampler.h — fast random sampling for the typing engine
+
+  Replaces the per-character Box-Muller path (2x random(), logf, sqrtf, cosf, then logf + expf for the
+  log-normal) with:
+    * FastRng        — xoshiro128** (32-bit ops only), seeded once per job; copyable so a plan can be replayed
+    * NormalZiggurat — Marsaglia & Tsang ziggurat, 128 layers; ~99% of samples are one compare + one multiply
+    * LogNormalSampler — mean · exp(σz − σ²/2) with exp(−σ²/2) cached per session and a polynomial fastExpf,
+                         so the log-normal IKI model needs no logf/expf at all on the hot path
+
+  Plain C++ (stdint + math); the tables are built once with libm at boot.
+*/
+#pragma once
+#include <stdint.h>
+#include <math.h>
+
+// xoshiro128** by Blackman & Vigna
+struct FastRng {
+  uint32_t s[4];
+
+  static inline uint32_t rotl(uint32_t x, int k){ return (x << k) | (x >> (32 - k)); }
+
+  // expand one seed word (e.g. esp_random()) with splitmix32 so the state is never all-zero
+  void seed(uint32_t x){
+    for(int i=0;i<4;i++){
+      x += 0x9e3779b9u;
+      uint32_t z = x;
+      z = (z ^ (z >> 16)) * 0x85ebca6bu;
+      z = (z ^ (z >> 13)) * 0xc2b2ae35u;
+      s[i] = z ^ (z >> 16);
+    }
+  }
+
+  inline uint32_t next(){
+    uint32_t r = rotl(s[1] * 5, 7) * 9;
+    uint32_t t = s[1] << 9;
+    s[2] ^= s[0]; s[3] ^= s[1]; s[1] ^= s[2]; s[0] ^= s[3];
+    s[2] ^= t; s[3] = rotl(s[3], 11);
+    return r;
+  }
+
+  // Same contract as Arduino random(lo, hi): lo..hi-1, lo when the range is empty. Multiply-shift, no division.
+  inline int32_t range(int32_t lo, int32_t hi){
+    if(hi <= lo) return lo;
+    return lo + (int32_t)(((uint64_t)next() * (uint32_t)(hi - lo)) >> 32);
+  }
+
+  inline float uniform(){ return (next() >> 8) * (1.0f / 16777216.0f); }             // [0,1)
+  inline float uniformPos(){ return ((next() >> 8) + 0.5f) * (1.0f / 16777216.0f); } // (0,1)
+};
+
+// exp(x) as 2^(x·log2e): the nearest integer goes into the exponent bits, the remaining fraction in
+// [-0.5, 0.5] through a degree-5 polynomial (relative error < 5e-6, plenty for timing noise)
+static inline float fastExpf(float x){
+  if(x < -87.0f) return 0.0f;
+  if(x > 88.0f) x = 88.0f;
+  float t = x * 1.44269504f;
+  int32_t i = (int32_t)(t + (t >= 0 ? 0.5f : -0.5f));
+  float f = (t - (float)i) * 0.69314718f;
+  float p = 1.0f + f*(1.0f + f*(0.5f + f*(0.16666667f + f*(0.041666667f + f*0.0083333333f))));
+  union { uint32_t u; float v; } b;
+  b.u = (uint32_t)(i + 127) << 23;
+  return p * b.v;
+}
+
+// Standard normal by the ziggurat method (Marsaglia & Tsang 2000, RNOR)
+struct NormalZiggurat {
+  uint32_t kn[128];
+  float wn[128], fn[128];
+
+  void init(){
+    const double m1 = 2147483648.0;
+    double dn = 3.442619855899, tn = dn, vn = 9.91256303526217e-3;
+    double q = vn / exp(-0.5 * dn * dn);
+    kn[0] = (uint32_t)((dn / q) * m1); kn[1] = 0;
+    wn[0] = (float)(q / m1); wn[127] = (float)(dn / m1);
+    fn[0] = 1.0f; fn[127] = (float)exp(-0.5 * dn * dn);
+    for(int i=126;i>=1;i--){
+      dn = sqrt(-2.0 * log(vn / dn + exp(-0.5 * dn * dn)));
+      kn[i+1] = (uint32_t)((dn / tn) * m1);
+      tn = dn;
+      fn[i] = (float)exp(-0.5 * dn * dn);
+      wn[i] = (float)(dn / m1);
+    }
+  }
+
+  inline float sample(FastRng &r) const {
+    for(;;){
+      int32_t hz = (int32_t)r.next();
+      uint32_t iz = (uint32_t)hz & 127;
+      uint32_t ahz = hz < 0 ? 0u - (uint32_t)hz : (uint32_t)hz;
+      if(ahz < kn[iz]) return hz * wn[iz]; // inside the layer's rectangle
+      float x = hz * wn[iz];
+      if(iz == 0){
+        // base layer: sample the tail beyond R
+        const float R = 3.442620f;
+        float y;
+        do { x = -logf(r.uniformPos()) * (1.0f / R); y = -logf(r.uniformPos()); } while(y + y < x * x);
+        return (hz > 0) ? R + x : -R - x;
+      }
+      if(fn[iz] + r.uniform() * (fn[iz-1] - fn[iz]) < expf(-0.5f * x * x)) return x;
+    }
+  }
+};
+
+// Log-normal inter-key interval with a given arithmetic mean:
+//   mean = exp(mu + σ²/2)  =>  sample = exp(mu + σz) = mean · exp(−σ²/2) · exp(σz)
+// exp(−σ²/2) is cached when σ is set (once per session), so mu never has to be derived from logf(mean).
+struct LogNormalSampler {
+  float sigma;
+  float meanCorr;   // exp(−σ²/2)
+
+  void setSigma(float s){ sigma = s; meanCorr = expf(-0.5f * s * s); }
+
+  inline float sample(FastRng &r, const NormalZiggurat &z, float mean) const {
+    return mean * meanCorr * fastExpf(sigma * z.sample(r));
+  }
+};
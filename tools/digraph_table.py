@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Generate digraph.h: the per-bigram latency scale used by the digraph timing model (engine.h).
+
+Re-run after changing the model:  python3 tools/digraph_table.py
+
+Chars fold into 27 classes (a-z case-insensitive, 26 = anything else). DIGRAPH_SCALE[prev][next] is the
+factor on the mean inter-key interval before `next`, in 1/64 units (64 = 1.0). The model is a touch typist
+on QWERTY:
+  * hand alternation is fast, same-hand rolls medium (inward rolls a little faster), same finger slow
+    and slower the more rows it travels; a doubled letter is a quick repeat
+  * the most common English bigrams are practised and get a further discount
+  * the table is normalised so English prose averages 1.0, leaving the configured WPM unchanged
+"""
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUT = os.path.join(ROOT, "digraph.h")
+OTHER = 26
+
+# QWERTY: letter -> (hand 0 left / 1 right, finger 0 pinky .. 3 index, row 0 top .. 2 bottom)
+FINGERS = {}
+for row, keys in enumerate(["qwertyuiop", "asdfghjkl", "zxcvbnm"]):
+    for col, ch in enumerate(keys):
+        hand = 0 if col < 5 else 1
+        finger = [0, 1, 2, 3, 3, 3, 3, 2, 1, 0][col]
+        FINGERS[ch] = (hand, finger, row)
+
+# English letter frequencies (%), for the normalisation weights
+LETTER_FREQ = dict(zip("etaoinshrdlcumwfgypbvkjxqz",
+                       [12.7, 9.1, 8.2, 7.5, 7.0, 6.7, 6.3, 6.1, 6.0, 4.3, 4.0, 2.8, 2.8, 2.4, 2.4, 2.2, 2.0, 2.0,
+                        1.9, 1.5, 1.0, 0.8, 0.15, 0.15, 0.1, 0.07]))
+COMMON = ("th he in er an re on at en nd ti es or te of ed is it al ar st to nt ng se ha as ou io le ve co me de "
+          "hi ri ro ic ne ea ra ce li ch ll be ma si om ur").split()
+
+
+def latency(a, b):
+    ha, fa, ra = FINGERS[a]
+    hb, fb, rb = FINGERS[b]
+    if a == b:
+        s = 0.95
+    elif ha != hb:
+        s = 0.82
+    elif fa == fb:
+        s = 1.45 + 0.15 * abs(ra - rb)
+    else:
+        s = 1.02 + 0.06 * abs(ra - rb) - (0.08 if fb > fa else 0.0)
+    if a + b in COMMON:
+        s *= 0.85
+    return s
+
+
+def main():
+    letters = "abcdefghijklmnopqrstuvwxyz"
+    raw = [[1.0] * 27 for _ in range(27)]
+    for i, a in enumerate(letters):
+        for j, b in enumerate(letters):
+            raw[i][j] = latency(a, b)
+    # weight every letter pair by its frequency, with the common bigrams boosted as in real text
+    wsum = ssum = 0.0
+    for i, a in enumerate(letters):
+        for j, b in enumerate(letters):
+            w = LETTER_FREQ[a] * LETTER_FREQ[b] * (4.0 if a + b in COMMON else 1.0)
+            wsum += w
+            ssum += w * raw[i][j]
+    norm = wsum / ssum
+    table = [[64] * 27 for _ in range(27)]
+    for i in range(26):
+        for j in range(26):
+            table[i][j] = max(32, min(160, round(raw[i][j] * norm * 64)))
+    cls = [OTHER] * 256
+    for i, a in enumerate(letters):
+        cls[ord(a)] = cls[ord(a.upper())] = i
+    with open(OUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("// Generated by tools/digraph_table.py — do not edit; re-run the script after changing the model\n")
+        f.write(f"// QWERTY touch-typist bigram model, normalised to English prose (x{norm:.3f})\n")
+        f.write("#pragma once\n\n")
+        f.write("#define DIGRAPH_OTHER 26        // class of every char that isn't a letter\n")
+        f.write("#define DIGRAPH_ONE 64          // scale 1.0\n\n")
+        f.write("const uint8_t DIGRAPH_CLASS[256] PROGMEM = {\n")
+        for r in range(0, 256, 32):
+            f.write("  " + ",".join(str(c) for c in cls[r:r + 32]) + ",\n")
+        f.write("};\n\n")
+        f.write("// [prev][next], rows and columns a..z then other\n")
+        f.write("const uint8_t DIGRAPH_SCALE[27][27] PROGMEM = {\n")
+        for i in range(27):
+            f.write("  { " + ",".join(f"{v:3d}" for v in table[i]) + " },\n")
+        f.write("};\n")
+    print(f"digraph.h: 27x27, normalisation x{norm:.3f}")
+
+
+if __name__ == "__main__":
+    main()
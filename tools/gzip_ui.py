@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+"""Pre-compress each sketch's INDEX_HTML into a PROGMEM header.
+
+Re-run after editing the web UI:  python3 tools/gzip_ui.py
+
+For every sketch it writes ui_<name>.h with INDEX_HTML_GZ (gzip, mtime 0 so the output is
+reproducible) and INDEX_HTML_HASH, the FNV-1a of the uncompressed page. The sketch hashes its
+INDEX_HTML at compile time and refuses to build if that no longer matches, so a UI edit can't ship
+a stale gzip copy; the raw page itself stays out of flash (except with -DTYPIST_UI_DEV).
+"""
+import gzip
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SKETCHES = {"esp32.ino": "ui_esp32.h", "15-11-2025.ino": "ui_15-11-2025.h", "pro(beta).cpp": "ui_pro.h"}
+PAGE = re.compile(r'INDEX_HTML\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral"', re.S)
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def main():
+    for src, out in SKETCHES.items():
+        with open(os.path.join(ROOT, src), encoding="utf-8") as f:
+            m = PAGE.search(f.read())
+        if not m:
+            raise SystemExit(f"{src}: INDEX_HTML not found")
+        raw = m.group(1).encode("utf-8")
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        rows = [", ".join(f"0x{b:02x}" for b in gz[i:i + 16]) for i in range(0, len(gz), 16)]
+        with open(os.path.join(ROOT, out), "w", encoding="utf-8", newline="\n") as f:
+            f.write(f"// Generated by tools/gzip_ui.py from INDEX_HTML in {src} — do not edit; re-run the script after UI changes\n")
+            f.write(f"// {len(raw)} bytes -> {len(gz)} bytes gzip\n")
+            f.write("#pragma once\n\n")
+            f.write(f"#define INDEX_HTML_HASH 0x{fnv1a(raw):08x}u  // FNV-1a of the uncompressed page\n\n")
+            f.write("const uint8_t INDEX_HTML_GZ[] PROGMEM = {\n  " + ",\n  ".join(rows) + "\n};\n")
+        print(f"{out}: {len(raw)} -> {len(gz)} bytes")
+
+
+if __name__ == "__main__":
+    main()
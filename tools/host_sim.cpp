@@ -0,0 +1,328 @@
+/*
+  host_sim.cpp — engine.h on a workstation, under a simulated clock
+
+  Types a large text through the real planner and player with no board attached: sleepUntil() just moves the
+  clock forward, HID reports are decoded back into text (backspace erases), and the result must equal the
+  filtered input. One run of 1 MB takes well under a second, so timing and typo behaviour can be profiled and
+  fuzzed here before anything is flashed.
+
+  Build and run (from the repo root):
+    g++ -std=c++17 -O2 -Wall -I. tools/host_sim.cpp -o host_sim
+    ./host_sim                                  1 MB of generated prose at the default config
+    ./host_sim --wpm 250 --strict --code file.c type a file in code mode at strict 250 WPM
+    ./host_sim --fuzz 500                       random configs, seeds and inputs; stops at the first mismatch
+    ./host_sim --plan text.kp text.txt          replay a plan from tools/make_plan.py and check what it types
+    ./host_sim --build strict --wpm 120         the lean strict-WPM engine (FeaturesStrict)
+
+  Options: --seed N, --wpm N, --code, --strict, --turbo, --no-typos, --digraph, --layout us|uk|dvorak, --build pro|classic|strict
+  (feature policy), --chars N (generated input size), --drops N (host disconnects after every Nth report and
+  reconnects 2 s later; the job must resume where it was), --resume N (the input is played like a stored document,
+  stopped N times at random chars and resumed from its marks each time; the joined output must be exact),
+  --upload N (bytes the "upload" delivers per wake-up, 0 = unlimited), --fuzz N, --plan FILE, [file].
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "engine.h"
+
+// ---------------- Simulated platform ----------------
+struct SimIo : EngineIo {
+  int64_t clock = 0;
+  uint32_t rngSeed = 1;
+  // producer: raw input streamed into textRing through the upload transform
+  const std::string *in = NULL;
+  size_t pos = 0, chunk = 0;
+  TextTransform xf;
+  // sink: text reconstructed from the HID reports, as a host set to the job's layout would see it
+  std::string out;
+  const KeyLayout *layout = &LAYOUTS[LAYOUT_US];
+  uint32_t reports = 0, backspaces = 0;
+
+  bool raw = false;  // keystroke plan: bytes go into the ring as they are
+  // link loss: the host goes away after every dropEvery-th report and is back dropUs later
+  uint32_t dropEvery = 0, drops = 0;
+  int64_t dropUs = 2000000;
+  bool linkUp = true;
+  // stored-document jobs (--resume): the input goes in through SourceFeed, leaving marks like the Pro docTask
+  SourceFeed src;
+  SourceMarks *marks = NULL;
+  uint32_t stopAt = 0;  // the job is stopped once this many chars are typed (0 = never)
+
+  void begin(const std::string &text, bool code, uint8_t nl, int lay, size_t perWake, bool plan){
+    in = &text; pos = 0; chunk = perWake; layout = &LAYOUTS[lay]; raw = plan; marks = NULL;
+    out.clear(); reports = backspaces = drops = 0; linkUp = true;
+    textRing.wr.store(0); textRing.rd.store(0); textRing.eof.store(false);
+    textRing.expected = (uint32_t)text.size(); textRing.code = code; textRing.plan = plan;
+    xf.begin(code, nl);
+    feed();
+  }
+
+  // A job over text from `start` on, as /type?file= plays it; out is kept, so resumed jobs add to the same host text
+  void beginSource(const std::string &text, const SourcePos &start, SourceMarks &m, bool code, uint8_t nl, int lay, size_t perWake){
+    in = &text; chunk = perWake; layout = &LAYOUTS[lay]; raw = false; marks = &m;
+    linkUp = true;
+    textRing.wr.store(0); textRing.rd.store(0); textRing.eof.store(false);
+    textRing.expected = (uint32_t)(text.size() - start.off); textRing.code = code; textRing.plan = false;
+    xf.begin(code, nl);
+    m.clear(); m.push(src.begin(xf, start));
+    if(start.off == text.size()) textRing.eof.store(true);
+    feed();
+  }
+
+  // one transform step consumes one input byte and yields at most one char, so n input bytes always fit
+  void feed(){
+    if(textRing.eof.load()) return;
+    size_t space = TEXT_RING_SIZE - (textRing.wr.load() - textRing.rd.load());
+    if(marks){
+      // whole windows only, like docTask
+      size_t n = std::min<size_t>(chunk ? chunk : SOURCE_MARK_SPACING, in->size() - src.pos.off);
+      if(n > space) return;
+      SourcePos m;
+      if(src.put((const uint8_t*)in->data() + src.pos.off, (uint32_t)n, m)) marks->push(m);
+      if(src.pos.off == in->size()) textRing.eof.store(true);
+      return;
+    }
+    size_t n = std::min(space, in->size() - pos);
+    if(chunk) n = std::min(n, chunk);
+    const uint8_t *p = (const uint8_t*)in->data() + pos, *end = p + n; char c;
+    uint32_t w = textRing.wr.load();
+    if(raw) while(p < end) textRing.buf[w++ & (TEXT_RING_SIZE - 1)] = *p++;
+    else while(xf.next(p, end, c)) textRing.buf[w++ & (TEXT_RING_SIZE - 1)] = (uint8_t)c;
+    textRing.wr.store(w);
+    pos += n;
+    if(pos == in->size()) textRing.eof.store(true);
+  }
+
+  int64_t nowUs() override { return clock; }
+  void sleepUntil(int64_t absUs) override { if(absUs > clock) clock = absUs; feed(); }
+  bool running() override { return !stopAt || typedChars < stopAt; }
+  bool paused() override { return false; }
+  void waitResume() override {}
+  void waitText() override { clock += 20000; feed(); }
+  uint32_t seed() override { return rngSeed; }
+  bool hidReady() override { return linkUp; }
+  bool waitHid(uint32_t ms) override {
+    if(dropUs > (int64_t)ms * 1000){ clock += (int64_t)ms * 1000; return false; }
+    clock += dropUs; feed(); drops++; linkUp = true;
+    return true;
+  }
+  void hidSend(const HidReport &r) override {
+    if(!linkUp){
+      // a key-up into the void is what a real drop does too; a key-down would be a lost keystroke
+      if(r.keys[0]){ fprintf(stderr, "key sent while the host was away\n"); exit(3); }
+      return;
+    }
+    reports++;
+    if(dropEvery && reports % dropEvery == 0) linkUp = false;
+    uint8_t shift = (r.mod & HID_MOD_LSHIFT) ? 1 : 0;
+    for(int k=0;k<6 && r.keys[k];k++){
+      if(r.keys[k] == HID_KEY_BACKSPACE){ backspaces++; if(!out.empty()) out.pop_back(); continue; }
+      char c = r.keys[k] < 128 ? layout->chr[shift][r.keys[k]] : 0;
+      out += c ? c : '?';
+    }
+  }
+};
+SimIo sim;
+
+// ---------------- Inputs ----------------
+static std::string genProse(size_t n, FastRng &r){
+  static const char *const WORDS[] = { "the", "quick", "brown", "fox", "jumps", "over", "a", "lazy", "dog,", "While",
+    "typing", "engine", "keeps", "steady", "time.", "Every", "keystroke", "is", "planned", "ahead;", "(and)", "played", "on",
+    "schedule!", "x=42", "\"quoted\"", "100%", "line\n", "crlf\r\n", "\tindent" };
+  std::string s; s.reserve(n + 16);
+  while(s.size() < n){ s += WORDS[r.range(0, 30)]; s += ' '; }
+  s.resize(n);
+  return s;
+}
+
+// Random bytes biased towards text, with control chars and bytes >= 128 (which have no key and are dropped)
+static std::string genFuzz(size_t n, FastRng &r){
+  std::string s(n, ' ');
+  for(size_t i=0;i<n;i++){
+    uint32_t k = r.range(0, 100);
+    s[i] = k < 70 ? (char)r.range(32, 127) : k < 80 ? ' ' : k < 86 ? '\n' : k < 90 ? '\r' : k < 94 ? '\t' : (char)r.range(0, 256);
+  }
+  return s;
+}
+
+// What the host should end up with: the upload transform, minus chars the HID table can't type (a '\b' in the
+// input really is typed as Backspace)
+static std::string expectedText(const std::string &raw, bool code, uint8_t nl, const KeyLayout &L){
+  TextTransform t; t.begin(code, nl);
+  std::string s; s.reserve(raw.size());
+  const uint8_t *p = (const uint8_t*)raw.data(), *end = p + raw.size(); char c;
+  while(t.next(p, end, c)){
+    uint8_t key, mod; hidLookup(L, c, key, mod);
+    if(key == HID_KEY_BACKSPACE){ if(!s.empty()) s.pop_back(); }
+    else if(key) s += c;
+  }
+  return s;
+}
+
+static bool readFile(const char *path, std::string &out){
+  FILE *f = fopen(path, "rb");
+  if(!f){ perror(path); return false; }
+  char buf[4096]; size_t n;
+  while((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+// ---------------- Runs ----------------
+enum { BUILD_PRO, BUILD_CLASSIC, BUILD_STRICT, BUILD_COUNT };
+static const char *const BUILD_NAMES[BUILD_COUNT] = { "pro", "classic", "strict" };
+static int build = BUILD_PRO;
+
+struct RunResult { bool ok; size_t at; double simS, wallMs; uint32_t chars, wpm, typos; };
+
+// want: the text the host must end up with; by default the filtered input (a plan needs it passed in)
+static RunResult runOnce(const std::string &raw, const EngineConfig &c, uint32_t seed, size_t perWake,
+                         const std::string *want = NULL, bool plan = false){
+  RunResult res = {};
+  std::string filtered;
+  if(!want){ filtered = expectedText(raw, c.codeMode, (uint8_t)c.newlineMode, LAYOUTS[c.layout]); want = &filtered; }
+  cfgPublish(c);
+  sim.clock = 0; sim.rngSeed = seed;
+  sim.begin(raw, c.codeMode, (uint8_t)c.newlineMode, c.layout, perWake, plan);
+  auto w0 = std::chrono::steady_clock::now();
+  if(build == BUILD_CLASSIC) typeLikeHuman<FeaturesClassic>((uint32_t)raw.size());
+  else if(build == BUILD_STRICT) typeLikeHuman<FeaturesStrict>((uint32_t)raw.size());
+  else typeLikeHuman((uint32_t)raw.size());
+  res.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - w0).count();
+  res.simS = sim.clock / 1e6;
+  res.chars = (uint32_t)typedChars; res.wpm = measuredWpm; res.typos = sim.backspaces;
+  res.ok = sim.out == *want;
+  if(!res.ok){ size_t i = 0; while(i < want->size() && i < sim.out.size() && (*want)[i] == sim.out[i]) i++; res.at = i; }
+  return res;
+}
+
+// The input as a stored document: stopped `stops` times at random chars, each time resumed from the marks like
+// /type?file=&resume=1. The host text of all the jobs together must be the filtered input, nothing lost or repeated.
+static RunResult runResumed(const std::string &raw, const EngineConfig &c, uint32_t seed, size_t perWake, uint32_t stops){
+  RunResult res = {};
+  std::string want = expectedText(raw, c.codeMode, (uint8_t)c.newlineMode, LAYOUTS[c.layout]);
+  cfgPublish(c);
+  sim.clock = 0; sim.rngSeed = seed;
+  sim.out.clear(); sim.reports = sim.backspaces = sim.drops = 0;
+  FastRng r; r.seed(seed ^ 0x9e3779b9u);
+  static SourceMarks marks;
+  SourcePos at = {}; at.startOfLine = true;
+  auto w0 = std::chrono::steady_clock::now();
+  for(uint32_t job = 0;; job++){
+    sim.beginSource(raw, at, marks, c.codeMode, (uint8_t)c.newlineMode, c.layout, perWake);
+    uint32_t left = (uint32_t)(raw.size() - at.off);
+    sim.stopAt = job < stops && left > 1 ? r.range(1, std::min<uint32_t>(left, 3 * TEXT_RING_SIZE)) : 0;
+    sim.rngSeed = seed + job;
+    typeLikeHuman(left);
+    res.chars += (uint32_t)typedChars;
+    bool complete = textRing.eof.load() && typedChars >= textRing.wr.load();
+    if(!sim.stopAt || typedChars < sim.stopAt || complete) break; // ran to the end
+    if(!marks.resumeAt((uint32_t)typedChars, at)){ fprintf(stderr, "job %u: no mark at or before char %lu\n", job, typedChars); break; }
+  }
+  sim.stopAt = 0;
+  res.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - w0).count();
+  res.simS = sim.clock / 1e6;
+  res.wpm = measuredWpm; res.typos = sim.backspaces;
+  res.ok = sim.out == want;
+  if(!res.ok){ size_t i = 0; while(i < want.size() && i < sim.out.size() && want[i] == sim.out[i]) i++; res.at = i; }
+  return res;
+}
+
+static void printResult(const char *tag, const RunResult &r){
+  printf("%s: %s  chars=%u  sim=%.1fs  wpm=%u  typos=%u  drops=%u  wall=%.1fms\n", tag, r.ok ? "ok" : "MISMATCH",
+         r.chars, r.simS, r.wpm, r.typos, sim.drops, r.wallMs);
+  if(!r.ok) printf("  first difference at output char %zu\n", r.at);
+}
+
+static int fuzz(uint32_t runs, uint32_t seed){
+  FastRng r; r.seed(seed);
+  for(uint32_t k=0;k<runs;k++){
+    EngineConfig c;
+    c.wpm = r.range(10, 400); c.strict = r.range(0, 2); c.jitterPct = r.range(0, 50); c.thinkChance = r.range(0, 20);
+    c.mistakePct = r.range(0, 30); c.typos = r.range(0, 4) != 0; c.longPauses = r.range(0, 2); c.longPausePct = r.range(0, 20);
+    c.newlineMode = r.range(0, 3); c.punctPause = r.range(0, 2); c.codeMode = r.range(0, 3) == 0;
+    c.typoMaxChars = r.range(1, 7); c.maxErrors = r.range(1, 4); c.turbo = r.range(0, 8) == 0;
+    c.layout = r.range(0, LAYOUT_COUNT); c.digraphs = r.range(0, 2);
+    build = r.range(0, 4) ? BUILD_PRO : r.range(BUILD_CLASSIC, BUILD_COUNT);
+    uint32_t runSeed = r.next();
+    std::string raw = genFuzz(r.range(0, 40000), r);
+    sim.dropEvery = r.range(0, 4) ? 0 : r.range(1, 2000);
+    uint32_t stops = (build == BUILD_PRO && !r.range(0, 4)) ? r.range(1, 6) : 0; // documents are a Pro feature
+    size_t perWake = r.range(0, 2) ? 0 : r.range(1, 4096);
+    RunResult res = stops ? runResumed(raw, c, runSeed, perWake, stops) : runOnce(raw, c, runSeed, perWake);
+    if(!res.ok){
+      printf("fuzz run %u (seed 0x%08x): build=%s wpm=%d strict=%d code=%d nl=%d turbo=%d typos=%d/%d%% max=%d layout=%s drops=%u resume=%u\n", k, runSeed, BUILD_NAMES[build],
+             c.wpm, c.strict, c.codeMode, c.newlineMode, c.turbo, c.typos, c.mistakePct, c.typoMaxChars, LAYOUT_NAMES[c.layout], sim.dropEvery, stops);
+      printResult("  result", res);
+      return 1;
+    }
+  }
+  printf("fuzz: %u runs ok\n", runs);
+  return 0;
+}
+
+int main(int argc, char **argv){
+  EngineConfig c;
+  uint32_t seed = 1, fuzzRuns = 0, resumes = 0;
+  size_t chars = 1 << 20, perWake = 0;
+  const char *file = NULL, *plan = NULL;
+  for(int i=1;i<argc;i++){
+    std::string a = argv[i];
+    bool more = i + 1 < argc;
+    if(a == "--seed" && more) seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+    else if(a == "--wpm" && more) c.wpm = clampInt(atoi(argv[++i]), 1, 1000);
+    else if(a == "--chars" && more) chars = strtoul(argv[++i], NULL, 0);
+    else if(a == "--upload" && more) perWake = strtoul(argv[++i], NULL, 0);
+    else if(a == "--fuzz" && more) fuzzRuns = (uint32_t)strtoul(argv[++i], NULL, 0);
+    else if(a == "--drops" && more) sim.dropEvery = (uint32_t)strtoul(argv[++i], NULL, 0);
+    else if(a == "--resume" && more) resumes = (uint32_t)strtoul(argv[++i], NULL, 0);
+    else if(a == "--layout" && more){
+      c.layout = -1;
+      for(int k=0;k<LAYOUT_COUNT;k++) if(strcmp(argv[i + 1], LAYOUT_NAMES[k]) == 0) c.layout = k;
+      if(c.layout < 0){ fprintf(stderr, "unknown layout %s\n", argv[i + 1]); return 2; }
+      i++;
+    }
+    else if(a == "--build" && more){
+      build = -1;
+      for(int k=0;k<BUILD_COUNT;k++) if(strcmp(argv[i + 1], BUILD_NAMES[k]) == 0) build = k;
+      if(build < 0){ fprintf(stderr, "unknown build %s\n", argv[i + 1]); return 2; }
+      i++;
+    }
+    else if(a == "--code") c.codeMode = true;
+    else if(a == "--strict") c.strict = true;
+    else if(a == "--turbo") c.turbo = true;
+    else if(a == "--no-typos") c.typos = false;
+    else if(a == "--digraph") c.digraphs = true;
+    else if(a == "--plan" && more) plan = argv[++i];
+    else if(a[0] != '-') file = argv[i];
+    else { fprintf(stderr, "unknown option %s\n", argv[i]); return 2; }
+  }
+  ziggurat.init();
+  engineIo = &sim;
+  if(fuzzRuns) return fuzz(fuzzRuns, seed);
+
+  std::string raw;
+  if(plan){
+    // replay an uploaded-format plan; the text file, if given, is what it should type (Enter kept)
+    std::string kp, text, want;
+    if(!readFile(plan, kp) || (file && !readFile(file, text))) return 2;
+    if(file) want = expectedText(text, false, 0, LAYOUTS[c.layout]);
+    RunResult res = runOnce(kp, c, seed, perWake, &want, true);
+    if(!file) res.ok = true;
+    printf("plan %zu bytes, %u chars planned\n", kp.size(), (unsigned)jobChars);
+    printResult("replay", res);
+    return res.ok ? 0 : 1;
+  }
+  if(file){
+    if(!readFile(file, raw)) return 2;
+  } else {
+    FastRng r; r.seed(seed);
+    raw = genProse(chars, r);
+  }
+  RunResult res = resumes ? runResumed(raw, c, seed, perWake, resumes) : runOnce(raw, c, seed, perWake);
+  printf("input %zu bytes, build=%s wpm=%d layout=%s%s%s%s\n", raw.size(), BUILD_NAMES[build], c.wpm, LAYOUT_NAMES[c.layout], c.strict ? " strict" : "", c.codeMode ? " code" : "", c.turbo ? " turbo" : "");
+  printResult("run", res);
+  return res.ok ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Compute a timed keystroke plan on the host and write it in the device's binary format (see engine.h,
+"Uploaded keystroke plans"). The device only replays it, so any timing model can live here.
+
+  python3 tools/make_plan.py text.txt -o text.kp --wpm 90 --typos 2
+  curl --data-binary @text.kp 'http://192.168.4.1/type?plan=1'
+  python3 tools/make_plan.py text.txt --post http://192.168.4.1     (both in one go)
+
+The model is deliberately simple (log-normal intervals, pauses after spaces and punctuation, random-letter
+typos corrected with Backspace) and types for a US layout host; swap in your own in plan_events().
+"""
+import argparse
+import math
+import random
+import sys
+import urllib.request
+
+PLAN_VERSION = 1
+TICK_US = 50
+F_DONE, F_TYPO, F_MOD = 0x01, 0x02, 0x04
+SHIFT = 0x02
+KEY_GAP_US = 2000
+
+US = {"\n": 0x28, "\t": 0x2b, " ": 0x2c, "\b": 0x2a}
+for rows, shifted in ((("`1234567890-=", "qwertyuiop[]\\", "asdfghjkl;'", "zxcvbnm,./"), False),
+                      (("~!@#$%^&*()_+", "QWERTYUIOP{}|", "ASDFGHJKL:\"", "ZXCVBNM<>?"), True)):
+    codes = ([0x35] + list(range(0x1e, 0x28)) + [0x2d, 0x2e],
+             [0x14, 0x1a, 0x08, 0x15, 0x17, 0x1c, 0x18, 0x0c, 0x12, 0x13, 0x2f, 0x30, 0x31],
+             [0x04, 0x16, 0x07, 0x09, 0x0a, 0x0b, 0x0d, 0x0e, 0x0f, 0x33, 0x34],
+             [0x1d, 0x1b, 0x06, 0x19, 0x05, 0x11, 0x10, 0x36, 0x37, 0x38])
+    for row, keys in zip(rows, codes):
+        for ch, k in zip(row, keys):
+            US.setdefault(ch, (k, SHIFT) if shifted else k)
+
+
+def lookup(ch):
+    v = US.get(ch)
+    if v is None:
+        return None
+    return v if isinstance(v, tuple) else (v, 0)
+
+
+def plan_events(text, wpm, typos, rng):
+    """Yield (down_us, hold_us, usage, modifier, flags) in key-down order."""
+    mean_us = 60e6 / (wpm * 5)
+    sigma = 0.35
+    t = 0.0
+    for ch in text:
+        k = lookup(ch)
+        if k is None:
+            continue
+        gap = mean_us * math.exp(rng.gauss(0, sigma) - sigma * sigma / 2)
+        if ch == " ":
+            gap += rng.uniform(40e3, 140e3)
+        elif ch in ".,;:!?":
+            gap += rng.uniform(80e3, 220e3)
+        if typos and ch.isalnum() and rng.random() * 100 < typos:
+            wrong = lookup(rng.choice("abcdefghijklmnopqrstuvwxyz"))
+            yield t, min(60e3, mean_us / 2), wrong[0], 0, F_TYPO
+            t += max(mean_us, 150e3)
+            yield t, 30e3, 0x2a, 0, 0
+            t += rng.uniform(60e3, 120e3)
+        hold = min(rng.uniform(30e3, 90e3), gap - KEY_GAP_US)
+        yield t, hold, k[0], k[1], F_DONE
+        t += gap
+
+
+def varint(v):
+    out = bytearray()
+    while True:
+        b = v & 0x7f
+        v >>= 7
+        out.append(b | (0x80 if v else 0))
+        if not v:
+            return out
+
+
+def encode(text, wpm, typos, seed):
+    rng = random.Random(seed)
+    text = text.replace("\r\n", "\n").replace("\r", "\n")
+    body = bytearray()
+    prev = 0
+    chars = 0
+    end = 0
+    for down, hold, key, mod, flags in plan_events(text, wpm, typos, rng):
+        d = round(down / TICK_US)
+        body.append(flags | (F_MOD if mod else 0))
+        body.append(key)
+        if mod:
+            body.append(mod)
+        body += varint(max(0, d - prev))
+        body += varint(max(1, round(hold / TICK_US)))
+        prev = d
+        chars += flags & F_DONE
+        end = max(end, down + hold)
+    return b"KP" + bytes([PLAN_VERSION]) + varint(chars) + varint(round(end / 1000)) + bytes(body), chars, end
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("text", help="input text file ('-' for stdin)")
+    ap.add_argument("-o", "--out", help="write the plan here")
+    ap.add_argument("--post", metavar="URL", help="device base URL, e.g. http://192.168.4.1")
+    ap.add_argument("--wpm", type=float, default=80)
+    ap.add_argument("--typos", type=float, default=0, help="typo chance per letter, %%")
+    ap.add_argument("--seed", type=int, default=1)
+    a = ap.parse_args()
+    src = sys.stdin.read() if a.text == "-" else open(a.text, encoding="utf-8").read()
+    data, chars, end = encode(src, a.wpm, a.typos, a.seed)
+    print(f"{chars} chars, {len(data)} bytes ({len(data) / max(chars, 1):.1f}/char), {end / 1e6:.1f} s", file=sys.stderr)
+    if a.out:
+        with open(a.out, "wb") as f:
+            f.write(data)
+    if a.post:
+        req = urllib.request.Request(a.post.rstrip("/") + "/type?plan=1", data=data, method="POST",
+                                     headers={"Content-Type": "application/octet-stream"})
+        with urllib.request.urlopen(req) as r:
+            print(r.read().decode(), file=sys.stderr)
+    if not a.out and not a.post:
+        sys.stdout.buffer.write(data)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""Drive the Pro sketch over its serial link (built with -DTYPIST_SERIAL_LINK=<baud>; protocol in the sketch,
+"Serial link"). Needs pyserial.
+
+  python3 tools/serial_type.py /dev/ttyUSB0 text.txt --baud 921600 --config 'wpm=90&typos=0'
+  python3 tools/make_plan.py text.txt -o text.kp && python3 tools/serial_type.py /dev/ttyUSB0 text.kp --plan
+  python3 tools/serial_type.py /dev/ttyUSB0 --status     (or --stop, --pause, --resume)
+
+Anything the board prints between frames (boot log, status lines) is skipped, or shown with --verbose.
+"""
+import argparse
+import json
+import struct
+import sys
+import time
+
+import serial
+
+PROTO_VERSION = 1
+MAGIC = 0xA5
+FRAME_MAX = 1024
+SL_PING, SL_ACK, SL_STATUS, SL_CONFIG, SL_BEGIN, SL_DATA, SL_END, SL_STOP, SL_PAUSE = range(9)
+NAMES = {SL_PING: "ping", SL_CONFIG: "config", SL_BEGIN: "begin", SL_DATA: "data", SL_END: "end", SL_STOP: "stop",
+         SL_PAUSE: "pause"}
+RESEND_S = 2.0     # a frame lost to a CRC error is resent after this long
+
+
+def crc16(data, c=0xFFFF):
+    for b in data:
+        c ^= b << 8
+        for _ in range(8):
+            c = ((c << 1) ^ 0x1021) & 0xFFFF if c & 0x8000 else (c << 1) & 0xFFFF
+    return c
+
+
+class Link:
+    def __init__(self, port, baud, verbose):
+        self.s = serial.Serial(port, baud, timeout=0.05)
+        self.buf = bytearray()
+        self.verbose = verbose
+
+    def send(self, typ, payload=b""):
+        body = bytes([typ]) + struct.pack("<H", len(payload)) + payload
+        self.s.write(bytes([MAGIC]) + body + struct.pack("<H", crc16(body)))
+
+    def frame(self, timeout):
+        """Next (type, payload), or None after timeout seconds."""
+        until = time.monotonic() + timeout
+        while True:
+            while len(self.buf) >= 6:
+                if self.buf[0] != MAGIC:
+                    i = self.buf.find(bytes([MAGIC]))
+                    self.skip(len(self.buf) if i < 0 else i)
+                    continue
+                n = self.buf[2] | self.buf[3] << 8
+                if n > FRAME_MAX:
+                    self.skip(1)
+                    continue
+                if len(self.buf) < 6 + n:
+                    break
+                f = bytes(self.buf[:6 + n])
+                if crc16(f[1:4 + n]) != (f[4 + n] | f[5 + n] << 8):
+                    self.skip(1)
+                    continue
+                del self.buf[:6 + n]
+                return f[1], f[4:4 + n]
+            if time.monotonic() > until:
+                return None
+            self.buf += self.s.read(max(1, self.s.in_waiting))
+
+    def skip(self, n):
+        if self.verbose and n:
+            sys.stderr.write(self.buf[:n].decode("latin-1"))
+        del self.buf[:n]
+
+    def call(self, typ, payload=b"", wait=None, upto=None):
+        """Send a command until its ack arrives; returns (status, val). wait: give up after this long (None = never).
+        upto: a data piece's end offset, so a late duplicate ack for the previous piece isn't taken for this one."""
+        start = time.monotonic()
+        while True:
+            self.send(typ, payload)
+            sent = time.monotonic()
+            while time.monotonic() - sent < RESEND_S:
+                f = self.frame(RESEND_S)
+                if f and f[0] == SL_ACK and len(f[1]) == 7:
+                    t, status, val = struct.unpack("<BhI", f[1])
+                    if t == typ and (upto is None or status != 200 or val == upto):
+                        return status, val
+            if wait is not None and time.monotonic() - start > wait:
+                raise SystemExit(f"no answer to {NAMES[typ]}")
+
+    def status(self):
+        self.send(SL_STATUS)
+        while True:
+            f = self.frame(RESEND_S)
+            if f is None:
+                raise SystemExit("no answer to status")
+            if f[0] == SL_STATUS:
+                return json.loads(f[1])
+
+
+def check(what, status, ok=(200,)):
+    if status not in ok:
+        raise SystemExit(f"{what}: {status}")
+
+
+def type_body(link, data, plan):
+    status, job = link.call(SL_BEGIN, struct.pack("<IB", len(data), 1 if plan else 0), wait=5)
+    check("begin", status)
+    t0 = time.monotonic()
+    piece = FRAME_MAX - 4
+    for off in range(0, len(data), piece):
+        # acked once the piece is in the ring, so this paces itself to the typer (no timeout: a paused job waits)
+        chunk = data[off:off + piece]
+        status, _ = link.call(SL_DATA, struct.pack("<I", off) + chunk, upto=off + len(chunk))
+        check(f"data at {off}", status)
+    status, got = link.call(SL_END, wait=5)
+    check("end", status)
+    print(f"job {job}: {got} bytes sent in {time.monotonic() - t0:.1f} s", file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("port", help="serial port, e.g. /dev/ttyUSB0 or COM5")
+    ap.add_argument("file", nargs="?", help="text (or a plan with --plan) to type; '-' for stdin")
+    ap.add_argument("--baud", type=int, default=115200, help="the sketch's TYPIST_SERIAL_LINK")
+    ap.add_argument("--plan", action="store_true", help="the file is a keystroke plan (tools/make_plan.py)")
+    ap.add_argument("--config", metavar="QUERY", help="/config-style settings first, e.g. 'wpm=90&typos=0'")
+    ap.add_argument("--status", action="store_true")
+    ap.add_argument("--stop", action="store_true")
+    ap.add_argument("--pause", action="store_true")
+    ap.add_argument("--resume", action="store_true")
+    ap.add_argument("--verbose", action="store_true", help="echo the board's own prints to stderr")
+    a = ap.parse_args()
+    link = Link(a.port, a.baud, a.verbose)
+    status, version = link.call(SL_PING, wait=5)
+    check("ping", status)
+    if version != PROTO_VERSION:
+        raise SystemExit(f"board speaks serial protocol {version}, this tool {PROTO_VERSION}")
+    if a.config:
+        check("config", link.call(SL_CONFIG, a.config.encode(), wait=5)[0])
+    if a.stop:
+        check("stop", link.call(SL_STOP, wait=5)[0])
+    if a.pause or a.resume:
+        check("pause", link.call(SL_PAUSE, bytes([1 if a.pause else 0]), wait=5)[0])
+    if a.file:
+        data = sys.stdin.buffer.read() if a.file == "-" else open(a.file, "rb").read()
+        if not data:
+            raise SystemExit("nothing to type")
+        type_body(link, data, a.plan)
+    if a.status:
+        print(json.dumps(link.status(), indent=2))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,187 @@
+// Generated by tools/gzip_ui.py from INDEX_HTML in 15-11-2025.ino — do not edit; re-run the script after UI changes
+// 8788 bytes -> 2853 bytes gzip
+#pragma once
+
+#define INDEX_HTML_HASH 0xd889902eu  // FNV-1a of the uncompressed page
+
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x5a, 0xd9, 0x72, 0xdb, 0x38,
+  0x16, 0x7d, 0xd7, 0x57, 0x20, 0x4c, 0x75, 0x49, 0x9a, 0xb6, 0x16, 0xca, 0xe9, 0x2c, 0x94, 0xa9,
+  0x4c, 0x77, 0x2a, 0x0f, 0xe9, 0xc9, 0xe2, 0x8a, 0xd3, 0x93, 0x9a, 0x9a, 0xea, 0x07, 0x88, 0x84,
+  0x24, 0xd8, 0x24, 0xc0, 0x22, 0x21, 0xcb, 0x1a, 0xb5, 0xab, 0xfa, 0x1f, 0x66, 0xbe, 0xb0, 0xbf,
+  0x64, 0xce, 0x05, 0x48, 0x89, 0x52, 0x24, 0xd9, 0x4e, 0x66, 0x79, 0xb0, 0x4d, 0x82, 0xb8, 0xfb,
+  0xb9, 0x0b, 0x90, 0x34, 0xce, 0x1e, 0xc5, 0x3a, 0x32, 0xcb, 0x4c, 0xb0, 0x99, 0x49, 0x93, 0x51,
+  0xe3, 0x8c, 0xfe, 0xb0, 0x84, 0xab, 0x69, 0xe8, 0x09, 0xe5, 0x8d, 0xce, 0x66, 0x82, 0xc7, 0xa3,
+  0xb3, 0x54, 0x18, 0xce, 0xa2, 0x19, 0xcf, 0x0b, 0x61, 0x42, 0x6f, 0x6e, 0x26, 0x9d, 0xe7, 0x5e,
+  0xaf, 0x5c, 0x56, 0x3c, 0x15, 0xa1, 0x77, 0x2d, 0xc5, 0x22, 0xd3, 0xb9, 0xf1, 0x58, 0xa4, 0x95,
+  0x11, 0x0a, 0xdb, 0x16, 0x32, 0x36, 0xb3, 0x30, 0x16, 0xd7, 0x32, 0x12, 0x1d, 0xfb, 0x72, 0x22,
+  0x95, 0x34, 0x92, 0x27, 0x9d, 0x22, 0xe2, 0x89, 0x08, 0x7d, 0xf0, 0x68, 0x9c, 0x19, 0x69, 0x12,
+  0x31, 0x7a, 0x7d, 0x71, 0x7e, 0x3a, 0x60, 0x3f, 0xbd, 0x7d, 0xcd, 0x3e, 0x2d, 0x33, 0x59, 0x98,
+  0xb3, 0x9e, 0x5b, 0x6f, 0x9c, 0x15, 0x66, 0x49, 0x7f, 0x83, 0x5c, 0x6b, 0xb3, 0xea, 0x74, 0xc6,
+  0xd3, 0xe0, 0x71, 0x7f, 0xdc, 0x9f, 0xf8, 0x4f, 0x86, 0x9d, 0x4e, 0xc4, 0xf3, 0x38, 0x78, 0xec,
+  0x0f, 0xfc, 0xe7, 0x03, 0x1f, 0xaf, 0xe9, 0xdc, 0x08, 0xbc, 0xf3, 0x67, 0x63, 0x3f, 0x1a, 0xe0,
+  0x9d, 0x47, 0x51, 0xf0, 0xf8, 0xc9, 0x78, 0x7c, 0x3a, 0x89, 0x6f, 0x1b, 0x7f, 0x5a, 0x8d, 0xf5,
+  0x4d, 0xa7, 0x90, 0xff, 0x90, 0x6a, 0x1a, 0x8c, 0x75, 0x1e, 0x8b, 0xbc, 0x83, 0x95, 0xdb, 0xc6,
+  0x58, 0xc7, 0xcb, 0x55, 0xca, 0xf3, 0xa9, 0x54, 0x81, 0x3f, 0xc8, 0x6e, 0x86, 0x13, 0x58, 0xd0,
+  0x99, 0xf0, 0x54, 0x26, 0xcb, 0xe0, 0x0d, 0x8c, 0xc9, 0x4f, 0x8a, 0x65, 0x61, 0x44, 0xda, 0x99,
+  0xcb, 0x93, 0x1f, 0x73, 0xe8, 0x7f, 0x52, 0x70, 0x55, 0x74, 0x0a, 0x91, 0xcb, 0xc9, 0x70, 0xcc,
+  0xa3, 0xab, 0x69, 0xae, 0xe7, 0x2a, 0x5e, 0xeb, 0x15, 0xe9, 0x44, 0xe7, 0xc1, 0x63, 0xf1, 0x54,
+  0xc4, 0x93, 0xa7, 0xb7, 0x8d, 0x2e, 0x79, 0x84, 0x4b, 0x25, 0x72, 0x48, 0xb9, 0x71, 0x9e, 0x08,
+  0x7c, 0xbf, 0xdf, 0x87, 0xa8, 0x52, 0x6c, 0x9f, 0xf1, 0xb9, 0xd1, 0xc3, 0x58, 0x16, 0x59, 0xc2,
+  0x97, 0xc1, 0x34, 0x97, 0xf1, 0x90, 0x7e, 0x75, 0x20, 0x15, 0x2b, 0x46, 0x74, 0xc0, 0x73, 0x9e,
+  0xaa, 0x22, 0xf0, 0x27, 0xf9, 0x70, 0xca, 0xb3, 0xc0, 0x7f, 0x92, 0x41, 0xf5, 0x3f, 0xa7, 0x22,
+  0x96, 0xbc, 0x95, 0x4a, 0x55, 0xb2, 0x7d, 0xf1, 0x1c, 0x5c, 0xdb, 0xab, 0x9a, 0xc8, 0x83, 0x6c,
+  0xd8, 0x29, 0xed, 0xbd, 0x25, 0xfd, 0xe0, 0xc5, 0x55, 0xcd, 0x8e, 0x6b, 0x9e, 0xb7, 0x9c, 0x6f,
+  0xdb, 0xc3, 0xd2, 0x51, 0x39, 0x8f, 0xe5, 0xbc, 0x70, 0xee, 0xc9, 0x78, 0x1c, 0x93, 0x0f, 0xed,
+  0x8b, 0xfb, 0x1e, 0xf8, 0xd9, 0x0d, 0x2b, 0x74, 0x22, 0x63, 0xf6, 0xd8, 0x7f, 0x36, 0xe8, 0x0f,
+  0x9e, 0xdd, 0x36, 0x12, 0x3e, 0x16, 0xc9, 0xaa, 0x32, 0x69, 0x9c, 0xe8, 0xe8, 0xaa, 0xf4, 0x8c,
+  0xe3, 0x6f, 0x83, 0xd5, 0x76, 0xce, 0x46, 0x54, 0x44, 0xe0, 0x9f, 0xae, 0x1d, 0x82, 0xc0, 0x18,
+  0xa3, 0xd3, 0xe0, 0x29, 0x19, 0x29, 0x55, 0x36, 0x37, 0x7f, 0x27, 0x90, 0x86, 0x6a, 0x9e, 0x8e,
+  0x45, 0xfe, 0xeb, 0x49, 0x21, 0x12, 0x11, 0x99, 0x13, 0x23, 0x6e, 0x0c, 0xcf, 0x05, 0x5f, 0x95,
+  0x3e, 0xed, 0xf7, 0xbf, 0x5b, 0x6b, 0xf7, 0x7c, 0xad, 0x5c, 0xa5, 0xfc, 0xf3, 0xbd, 0xea, 0x0e,
+  0x06, 0xa7, 0xfd, 0x53, 0xbe, 0x1d, 0xc6, 0x67, 0x7e, 0xdf, 0x7f, 0xbe, 0x1b, 0xc6, 0xb5, 0x30,
+  0xf2, 0xf6, 0x4c, 0xc8, 0xe9, 0xcc, 0x04, 0x83, 0x41, 0x7f, 0x07, 0x2f, 0x73, 0xd9, 0x49, 0xb5,
+  0xd2, 0x45, 0xc6, 0x23, 0x71, 0xf2, 0x4a, 0x2b, 0x48, 0xe1, 0xc5, 0xc9, 0x7a, 0x69, 0xb8, 0x98,
+  0x49, 0x84, 0xc1, 0x3e, 0x07, 0x59, 0x2e, 0x86, 0xfa, 0x5a, 0xe4, 0x93, 0x44, 0x2f, 0x3a, 0x8b,
+  0x1c, 0x51, 0x55, 0x3a, 0x4f, 0x79, 0x82, 0x90, 0xe4, 0x7a, 0xb1, 0xda, 0x76, 0x85, 0x4f, 0xc1,
+  0x72, 0x58, 0xca, 0x75, 0x52, 0xac, 0x1d, 0x3b, 0x49, 0xc4, 0x8d, 0x45, 0x04, 0x99, 0x47, 0x2f,
+  0x8e, 0x13, 0xfd, 0x02, 0xb4, 0xe7, 0xa0, 0x55, 0xab, 0x9a, 0x4f, 0x58, 0x2d, 0x6a, 0x95, 0x63,
+  0x5e, 0xbc, 0x78, 0xb1, 0x71, 0x8d, 0xd2, 0x4a, 0x0c, 0xbf, 0x00, 0x03, 0x32, 0xa9, 0x5d, 0x39,
+  0xc4, 0xba, 0xe7, 0x85, 0xb3, 0x7a, 0xe1, 0xfc, 0xf0, 0xac, 0xdf, 0x1f, 0x46, 0xf3, 0xbc, 0xc0,
+  0xe7, 0x4c, 0x4b, 0x4a, 0x99, 0x4a, 0x76, 0x77, 0x3a, 0xd3, 0x85, 0xa9, 0xa3, 0xcb, 0xe4, 0x48,
+  0x9e, 0x0c, 0x9e, 0x54, 0xe6, 0x70, 0x38, 0x76, 0x53, 0xa8, 0x30, 0xdc, 0xcc, 0x8b, 0xd5, 0x43,
+  0x3c, 0xbd, 0x27, 0xa2, 0x6b, 0xe4, 0xf6, 0xef, 0x09, 0x0e, 0x1f, 0x01, 0x1e, 0x58, 0xf9, 0x08,
+  0x4b, 0xb2, 0xaa, 0x61, 0x95, 0xbc, 0xf8, 0x25, 0x9a, 0x69, 0x27, 0x08, 0x45, 0xfe, 0x11, 0xf1,
+  0xdb, 0x8a, 0x10, 0x4f, 0xe4, 0x54, 0x75, 0x10, 0xfb, 0xb4, 0x08, 0x22, 0x41, 0x1e, 0xaa, 0x82,
+  0x56, 0xa7, 0x61, 0x35, 0xac, 0xc3, 0x4d, 0x53, 0xf1, 0x6b, 0x0d, 0xda, 0xb7, 0x8d, 0xb3, 0x5e,
+  0x59, 0x0c, 0xcf, 0x7a, 0xae, 0x2e, 0x53, 0xe9, 0xc2, 0x5b, 0x2c, 0xaf, 0x59, 0x04, 0xeb, 0x8b,
+  0xd0, 0x5b, 0x27, 0xbe, 0x37, 0x6a, 0x30, 0xb6, 0xf5, 0x05, 0xf9, 0x6c, 0x17, 0xb1, 0x3c, 0xf3,
+  0xf7, 0x14, 0x5c, 0x2c, 0xba, 0xaf, 0x35, 0x22, 0xe0, 0xb0, 0xa4, 0xc1, 0xba, 0xcd, 0x68, 0x66,
+  0xeb, 0x72, 0xe8, 0x9d, 0x73, 0x94, 0x44, 0xa6, 0x73, 0x66, 0xbb, 0x87, 0x99, 0xe1, 0x07, 0x09,
+  0xc2, 0x96, 0x7a, 0xce, 0x16, 0x5c, 0x19, 0xbb, 0xe2, 0x64, 0x18, 0xcd, 0x0a, 0xa1, 0x62, 0xc6,
+  0x0b, 0x76, 0x25, 0x96, 0x63, 0x0d, 0x3d, 0x9c, 0x9d, 0xde, 0xe8, 0x13, 0x91, 0xe0, 0x3b, 0xf1,
+  0x38, 0xeb, 0x59, 0xfe, 0x6b, 0x69, 0x55, 0xbe, 0x31, 0x19, 0x87, 0x1e, 0xbd, 0x78, 0x0c, 0xee,
+  0x8c, 0xc4, 0x4c, 0x27, 0x70, 0x56, 0xa5, 0x00, 0xe4, 0xe5, 0x68, 0x39, 0xb1, 0x53, 0x85, 0xd8,
+  0xcd, 0x44, 0x2e, 0xba, 0xdd, 0x2e, 0x7a, 0x57, 0xaf, 0x62, 0x51, 0xda, 0xd5, 0x83, 0x61, 0x7b,
+  0x4d, 0x64, 0x55, 0x56, 0x6d, 0x6c, 0x75, 0xe8, 0x65, 0x5a, 0x45, 0x89, 0x8c, 0xae, 0x42, 0x8f,
+  0x2c, 0x20, 0x6d, 0x5b, 0x6d, 0xaf, 0xf2, 0xc0, 0x05, 0x19, 0xb5, 0x36, 0x9c, 0xac, 0xc0, 0x73,
+  0xc6, 0x65, 0x2e, 0x62, 0xe6, 0xba, 0x1e, 0x0c, 0x24, 0xe7, 0x80, 0x0f, 0xd4, 0x98, 0x0a, 0xf8,
+  0xd8, 0xb1, 0xdd, 0x95, 0x52, 0x6a, 0x62, 0x53, 0xc5, 0xdb, 0xc8, 0xe4, 0x59, 0x96, 0x2c, 0x81,
+  0xec, 0x89, 0x9c, 0xd6, 0xc4, 0xfe, 0x48, 0xab, 0x0c, 0xd9, 0x46, 0x19, 0x04, 0xcf, 0x1a, 0x03,
+  0x48, 0x43, 0x73, 0xb7, 0x5e, 0xbd, 0x3f, 0x50, 0x14, 0x94, 0xbb, 0xb0, 0x29, 0x56, 0x13, 0xf4,
+  0x51, 0x4c, 0x72, 0x51, 0xcc, 0x98, 0xcb, 0x3d, 0x36, 0xc9, 0x75, 0xea, 0x22, 0xea, 0x8d, 0xdc,
+  0xde, 0x07, 0xca, 0x28, 0x8c, 0xce, 0x08, 0x6b, 0xaa, 0x6e, 0xcd, 0x9b, 0xd4, 0xb6, 0x30, 0x23,
+  0x48, 0x77, 0x6c, 0x60, 0x5c, 0x01, 0x1c, 0x9d, 0x2c, 0xd7, 0x53, 0x08, 0x2f, 0x08, 0x19, 0x20,
+  0x60, 0x97, 0x7a, 0x0c, 0xa9, 0x9f, 0x3e, 0x9c, 0x7f, 0x21, 0xf3, 0x51, 0xa7, 0xc3, 0xce, 0x91,
+  0x66, 0xbd, 0x73, 0x3e, 0x2f, 0x04, 0x2b, 0x55, 0xe8, 0x74, 0x8e, 0x2b, 0x45, 0x98, 0xa2, 0xe4,
+  0xcc, 0x88, 0xa8, 0xa6, 0xa3, 0xd1, 0xd3, 0x69, 0x22, 0x2c, 0xab, 0x9a, 0x92, 0x8e, 0x35, 0x00,
+  0x06, 0x95, 0xe6, 0xa9, 0x28, 0x95, 0xf2, 0x46, 0x1b, 0xb9, 0xdb, 0x6a, 0x1d, 0x46, 0x1a, 0x50,
+  0x59, 0x5b, 0x70, 0x9e, 0x75, 0xda, 0x94, 0xcf, 0xa3, 0x8f, 0x48, 0xec, 0x65, 0xd7, 0x71, 0x28,
+  0xf9, 0x34, 0xd6, 0x86, 0xbe, 0x95, 0xd7, 0x82, 0x7d, 0x3e, 0x7f, 0xc7, 0x5c, 0xc5, 0x60, 0xad,
+  0x6b, 0x59, 0xc8, 0x71, 0x22, 0x18, 0xda, 0x4a, 0x52, 0xe9, 0x05, 0x17, 0x22, 0xd9, 0x92, 0x05,
+  0x5f, 0x16, 0x0c, 0xbe, 0x35, 0x1c, 0x1b, 0xda, 0x6b, 0x8f, 0xdc, 0x2f, 0xbb, 0xbf, 0x10, 0xe4,
+  0xff, 0xf1, 0xfb, 0x3f, 0x07, 0xfd, 0x7e, 0xbb, 0xcb, 0xde, 0xa1, 0x65, 0x31, 0x69, 0xb6, 0x45,
+  0x02, 0xfd, 0x52, 0xc1, 0x04, 0x65, 0x08, 0x9b, 0x33, 0x2a, 0x5d, 0xac, 0xc8, 0x84, 0x40, 0xc5,
+  0xa9, 0x58, 0xed, 0xe6, 0x77, 0xdd, 0x0f, 0x55, 0xfd, 0x5b, 0x6b, 0x83, 0xef, 0xb6, 0x44, 0x58,
+  0xd7, 0x24, 0xe0, 0xf0, 0x39, 0x4b, 0x2f, 0xec, 0x2e, 0xcf, 0x16, 0x0b, 0xe8, 0x4e, 0x32, 0x3c,
+  0x86, 0x66, 0x1c, 0x7a, 0x3e, 0xfe, 0xf2, 0x9b, 0xd0, 0x83, 0x82, 0x1e, 0xbb, 0xe6, 0xc9, 0x1c,
+  0xdf, 0x7d, 0x7a, 0xd6, 0xca, 0x72, 0x09, 0x3d, 0xad, 0xde, 0x3a, 0x26, 0xaf, 0xac, 0x6e, 0x2d,
+  0x33, 0x93, 0x45, 0xd7, 0xee, 0x44, 0x94, 0x7b, 0x35, 0xa9, 0x75, 0xad, 0xa8, 0xe6, 0x7b, 0x75,
+  0x0d, 0xfe, 0xca, 0x13, 0x6f, 0x04, 0xc6, 0xce, 0x9c, 0x75, 0x8c, 0xb7, 0x03, 0xbe, 0x8e, 0x59,
+  0xed, 0xe9, 0x50, 0x19, 0x1e, 0x8c, 0x7e, 0x12, 0x33, 0x7e, 0x2d, 0x75, 0x8e, 0xf2, 0x3b, 0x78,
+  0x48, 0x80, 0x3e, 0xa3, 0x57, 0x15, 0x2c, 0x43, 0x68, 0xe0, 0x01, 0xf4, 0x1e, 0x5b, 0x7c, 0x5c,
+  0xd5, 0x61, 0x0b, 0x99, 0x24, 0x8c, 0xcb, 0x94, 0x4d, 0x34, 0xda, 0x00, 0x45, 0xb1, 0xe5, 0xf7,
+  0x11, 0xbf, 0x53, 0xc4, 0x6f, 0x37, 0x0a, 0x1b, 0x2f, 0x2f, 0xb2, 0xb4, 0xf2, 0xad, 0x1b, 0xb3,
+  0x2a, 0xe7, 0xf6, 0x4b, 0xef, 0x9e, 0xee, 0x7a, 0xb7, 0xb7, 0x6b, 0xf1, 0x7d, 0x95, 0xbf, 0x30,
+  0xb9, 0x8c, 0x0c, 0x4b, 0xa9, 0x6c, 0xa3, 0x4b, 0x12, 0x40, 0x01, 0xd5, 0x1b, 0x4c, 0x06, 0x05,
+  0x6b, 0xd9, 0x94, 0x2c, 0x4e, 0x48, 0x15, 0x5d, 0xb4, 0x1d, 0x98, 0x65, 0x5a, 0x90, 0x31, 0xd8,
+  0xc3, 0x41, 0x67, 0x64, 0x6a, 0xd3, 0xaf, 0x64, 0xb3, 0x07, 0x5b, 0x6e, 0x3e, 0x2c, 0xf3, 0x8a,
+  0x36, 0x21, 0xef, 0x74, 0x66, 0x24, 0xea, 0x40, 0x69, 0x40, 0xdf, 0x1b, 0x7d, 0x98, 0x4c, 0xce,
+  0x7a, 0x6e, 0x75, 0xf7, 0xab, 0x8f, 0xaf, 0x6a, 0xf3, 0xb1, 0xe7, 0xf8, 0x7d, 0xad, 0xb9, 0x1f,
+  0x61, 0x03, 0x6a, 0xa7, 0x53, 0x1b, 0x22, 0x70, 0x84, 0xb0, 0xc2, 0xa4, 0xa2, 0x00, 0xd2, 0x34,
+  0xc0, 0xfe, 0xf8, 0xfd, 0x5f, 0x6c, 0x86, 0x51, 0x0a, 0xf1, 0x0c, 0xe1, 0x97, 0x1c, 0xe7, 0xb1,
+  0x79, 0xca, 0x55, 0x27, 0x91, 0x57, 0x82, 0x5d, 0x4a, 0x63, 0xa8, 0xa1, 0xff, 0x6c, 0xff, 0xb2,
+  0xd6, 0x77, 0x47, 0xa2, 0x58, 0xee, 0xdd, 0x17, 0xc8, 0x1f, 0xca, 0x38, 0x3e, 0xf9, 0x61, 0x13,
+  0xc6, 0xc1, 0x37, 0x44, 0x91, 0x52, 0x09, 0x68, 0x6b, 0xf9, 0x64, 0xc8, 0xfb, 0x36, 0x10, 0xc8,
+  0x0d, 0xe3, 0xf8, 0x23, 0xd5, 0x15, 0x19, 0x9a, 0xb9, 0xaa, 0x19, 0xd1, 0x60, 0xc8, 0xf8, 0x84,
+  0x54, 0xe7, 0xcc, 0xce, 0x66, 0xd6, 0x5c, 0x74, 0x2a, 0xd6, 0xa7, 0xc2, 0x51, 0x22, 0x00, 0xcd,
+  0x72, 0x9b, 0xb2, 0x62, 0x7c, 0xd8, 0x58, 0x2b, 0x6a, 0xaf, 0xad, 0x15, 0x66, 0xfd, 0x1a, 0x66,
+  0xbf, 0x05, 0xb1, 0xaf, 0x15, 0xa9, 0xc8, 0x0a, 0x99, 0xce, 0xe9, 0x1c, 0x15, 0x3b, 0x74, 0x5a,
+  0x70, 0x46, 0x1a, 0x9d, 0x38, 0xa2, 0x80, 0xa2, 0x7a, 0x97, 0xfb, 0xec, 0xd7, 0x23, 0xa0, 0xb4,
+  0xdf, 0xbd, 0x3d, 0xa8, 0xfb, 0x9b, 0x28, 0x0e, 0x61, 0x12, 0x88, 0x7d, 0xaf, 0xff, 0x63, 0x98,
+  0x2c, 0x83, 0xa7, 0x27, 0x88, 0x49, 0x8a, 0xf1, 0x8f, 0x03, 0x67, 0x54, 0x4d, 0xe8, 0x90, 0x8f,
+  0x1c, 0x23, 0x98, 0x51, 0xc9, 0x80, 0xff, 0xda, 0xde, 0xe8, 0xdd, 0x66, 0x03, 0xa1, 0xf5, 0x70,
+  0x40, 0x4a, 0x4e, 0xe7, 0x48, 0xb8, 0xfb, 0x46, 0xe5, 0xf4, 0x1b, 0xa2, 0xf2, 0x8e, 0xdf, 0x20,
+  0x20, 0x29, 0x8d, 0x6f, 0x85, 0x88, 0xe6, 0x86, 0x3a, 0x4d, 0xa9, 0x02, 0x62, 0x93, 0xe0, 0x58,
+  0x85, 0x48, 0xb5, 0xfa, 0x9b, 0x1a, 0xb3, 0x6f, 0x23, 0xec, 0x7b, 0xb5, 0x67, 0xf9, 0xb0, 0x91,
+  0xc4, 0x84, 0x3c, 0x72, 0x87, 0x89, 0x9b, 0x24, 0xfb, 0x76, 0xdc, 0x21, 0x89, 0x78, 0x81, 0xb0,
+  0xf3, 0x84, 0x25, 0x1a, 0xfd, 0x2b, 0xdf, 0xc9, 0x32, 0x58, 0x6b, 0x5c, 0x6a, 0x6d, 0x30, 0x48,
+  0x1b, 0xcb, 0xaf, 0x47, 0x90, 0x98, 0x64, 0xf6, 0x9a, 0xe7, 0xff, 0x07, 0xc4, 0xcf, 0x33, 0xa1,
+  0x98, 0x50, 0x11, 0x0e, 0x6a, 0x40, 0x1d, 0x59, 0xa4, 0xc4, 0x22, 0xc1, 0x09, 0xa6, 0x08, 0x70,
+  0x5c, 0x10, 0x19, 0x7b, 0x4d, 0xeb, 0xac, 0x87, 0xd9, 0xcb, 0x8e, 0xff, 0xe8, 0x6e, 0x66, 0x56,
+  0x96, 0x11, 0x5a, 0x4c, 0x31, 0x8e, 0x40, 0x21, 0x47, 0xc3, 0x80, 0xea, 0x18, 0x0f, 0xd3, 0x23,
+  0x16, 0xab, 0x64, 0x5f, 0x33, 0xf8, 0xcb, 0x5a, 0xd4, 0xe1, 0x9e, 0xc0, 0x1c, 0x17, 0x11, 0x63,
+  0x48, 0xdb, 0xd5, 0xe5, 0x10, 0xd5, 0x80, 0x26, 0x3a, 0xd2, 0xf1, 0x3e, 0x0e, 0x9b, 0xe5, 0xcc,
+  0x1e, 0xf0, 0x42, 0xaf, 0x3c, 0x9c, 0x96, 0xc7, 0x60, 0x77, 0xa5, 0x62, 0x61, 0xb4, 0x1e, 0x1c,
+  0x5e, 0x51, 0xf3, 0xb4, 0x1d, 0xb4, 0x85, 0xaa, 0x94, 0x61, 0xc4, 0x7b, 0xe8, 0x08, 0xb1, 0xa9,
+  0x69, 0xa0, 0x66, 0x96, 0xdf, 0x3b, 0xcb, 0x0f, 0x27, 0x55, 0xea, 0x40, 0x0e, 0x4f, 0x16, 0x59,
+  0x38, 0xbe, 0x18, 0xaa, 0x15, 0xe4, 0x63, 0x9b, 0x2f, 0xe5, 0xde, 0x23, 0x6e, 0xa6, 0x33, 0x19,
+  0xa9, 0xf7, 0x3f, 0xe8, 0xbc, 0x6e, 0x50, 0x1b, 0x59, 0x24, 0x6d, 0xcc, 0x90, 0x05, 0xfb, 0xf0,
+  0xde, 0x9d, 0xcf, 0xec, 0x01, 0xd7, 0x8d, 0x45, 0xc5, 0x95, 0xcc, 0xd8, 0x8f, 0x6f, 0xdf, 0xb2,
+  0x04, 0x73, 0x36, 0xa1, 0xcd, 0x5e, 0xc8, 0x38, 0x38, 0x71, 0x77, 0x6a, 0x5d, 0x5b, 0x2b, 0x78,
+  0x34, 0xb3, 0x26, 0xc3, 0xc5, 0xd6, 0x17, 0x18, 0x4a, 0xf8, 0x18, 0xbf, 0x85, 0x89, 0xba, 0x98,
+  0x84, 0x4b, 0xd0, 0xc1, 0x45, 0xf0, 0x56, 0x86, 0xb3, 0x81, 0xc8, 0xaf, 0x45, 0xdc, 0x5d, 0x0f,
+  0x83, 0xe5, 0x43, 0xa5, 0xf6, 0x59, 0x11, 0xe5, 0x32, 0x83, 0x2d, 0xbc, 0x58, 0xaa, 0x88, 0x4d,
+  0xe6, 0xca, 0x76, 0x0d, 0xb6, 0x75, 0xcc, 0x5b, 0x81, 0x8e, 0x0a, 0x8c, 0x61, 0x19, 0x26, 0x01,
+  0xa4, 0x02, 0xfb, 0xe5, 0xe3, 0xdb, 0x0b, 0xc1, 0xf3, 0x68, 0x76, 0x8e, 0xca, 0x9c, 0x16, 0xad,
+  0x95, 0xb5, 0x1f, 0xd3, 0x5a, 0xc0, 0x62, 0x1d, 0xe1, 0x38, 0xa2, 0x4c, 0x17, 0xc7, 0xb7, 0xd7,
+  0x89, 0xa0, 0xc7, 0x9f, 0x96, 0x6f, 0xe2, 0x56, 0x13, 0x5f, 0x9b, 0x6d, 0x37, 0xdf, 0x9e, 0xd8,
+  0xed, 0x6e, 0x0a, 0x3a, 0x42, 0xe1, 0x36, 0x6c, 0x13, 0xb9, 0x59, 0xe2, 0x08, 0x91, 0xdb, 0xb0,
+  0x4d, 0x64, 0x0b, 0xd3, 0x11, 0x1a, 0xfb, 0x7d, 0x87, 0x84, 0xba, 0xe1, 0x31, 0x12, 0xfa, 0xbe,
+  0x4d, 0x42, 0x65, 0xeb, 0x08, 0x05, 0x7d, 0xde, 0x26, 0x50, 0xc9, 0x91, 0xed, 0x2a, 0xd9, 0xde,
+  0x5c, 0x61, 0xf7, 0x08, 0x49, 0xb5, 0x65, 0x57, 0xad, 0x28, 0x60, 0x3f, 0x54, 0xcf, 0x68, 0x08,
+  0x01, 0x7b, 0xda, 0xef, 0xaf, 0xdf, 0xf9, 0x4d, 0xc0, 0xfc, 0x41, 0xb5, 0x40, 0x61, 0x3e, 0x2a,
+  0xc1, 0xb5, 0x99, 0x6d, 0x09, 0x9b, 0x0e, 0x7b, 0x84, 0x74, 0xb3, 0xa9, 0x22, 0x06, 0xed, 0x6d,
+  0x7b, 0xb8, 0xc6, 0x16, 0x4d, 0x99, 0x7c, 0xc1, 0x71, 0x8a, 0x9b, 0x00, 0xcb, 0xb3, 0x56, 0xb3,
+  0x17, 0x59, 0xfc, 0xbd, 0x6c, 0xb2, 0xef, 0x59, 0xd6, 0x35, 0x9a, 0x46, 0x6b, 0x3a, 0xa7, 0xd7,
+  0x68, 0xcc, 0x9a, 0x26, 0xef, 0x1a, 0x7b, 0x13, 0x42, 0xdf, 0x8e, 0x00, 0x8a, 0xce, 0xb3, 0x90,
+  0x2f, 0x95, 0x12, 0xb9, 0xbd, 0xe8, 0x09, 0x99, 0x19, 0x36, 0x6e, 0x1b, 0xbb, 0xf8, 0xdf, 0x5c,
+  0xad, 0x10, 0xb4, 0x9d, 0x88, 0xad, 0x9c, 0xd8, 0xe8, 0x10, 0x73, 0xc3, 0xc1, 0xe6, 0x30, 0x52,
+  0xc0, 0xa6, 0x32, 0x99, 0xa8, 0xe4, 0xa4, 0xf5, 0xc8, 0xd2, 0xfc, 0xf6, 0x9b, 0xa5, 0xed, 0xc2,
+  0xac, 0xb4, 0xd5, 0x0e, 0xc3, 0xb0, 0xd9, 0x6c, 0xaf, 0x1e, 0xa2, 0x7c, 0xd8, 0x7c, 0xaf, 0x09,
+  0xba, 0xd3, 0xea, 0x3a, 0xab, 0x39, 0x44, 0xf3, 0x31, 0xf3, 0x5c, 0x0d, 0xd9, 0xed, 0xc3, 0xfc,
+  0x10, 0x36, 0xe9, 0xe6, 0x08, 0xac, 0xba, 0xdd, 0x6e, 0x93, 0xb4, 0x34, 0xf9, 0x72, 0xb5, 0x46,
+  0xc4, 0xbe, 0xe0, 0xd0, 0x9c, 0xd1, 0x3c, 0x61, 0xab, 0x54, 0x98, 0x99, 0x8e, 0x83, 0xe6, 0xf9,
+  0x87, 0x8b, 0x4f, 0x78, 0xa7, 0x3b, 0x40, 0x91, 0x17, 0xc1, 0xaa, 0xf9, 0xca, 0xfd, 0x9b, 0x4b,
+  0x87, 0xae, 0x9b, 0x9a, 0x81, 0x75, 0x43, 0x0f, 0x1d, 0x4a, 0xaa, 0xe6, 0xed, 0x09, 0xa3, 0x4b,
+  0xc2, 0x80, 0xac, 0x77, 0x08, 0x38, 0x1e, 0xcf, 0xaf, 0x88, 0x28, 0xa0, 0x15, 0x71, 0x52, 0x54,
+  0x3c, 0xcc, 0xa5, 0xa0, 0x6e, 0xbe, 0xce, 0x73, 0x34, 0x38, 0xd6, 0xfc, 0x5e, 0xc0, 0x8b, 0x7b,
+  0xa0, 0x51, 0xbb, 0x32, 0x5a, 0x95, 0x9e, 0x3a, 0xe8, 0x25, 0xda, 0xdc, 0x6c, 0x0f, 0x0f, 0x9b,
+  0xf7, 0x60, 0xd3, 0x58, 0xed, 0x5a, 0x6c, 0xf8, 0x0d, 0x56, 0x5e, 0xd0, 0xc5, 0x96, 0x20, 0x53,
+  0x9b, 0x43, 0x67, 0x67, 0xaf, 0xc7, 0xdc, 0x55, 0x93, 0x9b, 0xd0, 0x7a, 0xee, 0x62, 0x69, 0xd7,
+  0xfc, 0xad, 0xdb, 0xa8, 0xd5, 0x7d, 0x90, 0x62, 0xb9, 0x35, 0xff, 0x5b, 0x71, 0x66, 0x5b, 0x0e,
+  0xf9, 0xea, 0xc0, 0x87, 0x4d, 0x77, 0xa1, 0x26, 0x76, 0x82, 0x0f, 0xa7, 0x24, 0xd5, 0xbd, 0x53,
+  0x79, 0x23, 0x6b, 0x4f, 0x8a, 0x11, 0xda, 0x3b, 0x06, 0x79, 0x7b, 0x62, 0xc6, 0x10, 0xde, 0x48,
+  0x70, 0x72, 0x2c, 0x6f, 0x64, 0x3e, 0xc9, 0x54, 0xe8, 0x39, 0x29, 0xa8, 0xe6, 0x49, 0x32, 0x6c,
+  0xac, 0x5d, 0xb7, 0x7b, 0xe1, 0x73, 0x6d, 0xfd, 0x77, 0xb8, 0x61, 0xac, 0x2f, 0x78, 0x76, 0xec,
+  0xbe, 0x46, 0x41, 0x6c, 0x92, 0x46, 0x36, 0x53, 0xa1, 0x61, 0x2c, 0xc6, 0x18, 0x55, 0x31, 0x2d,
+  0xe4, 0x3c, 0x93, 0x71, 0x75, 0x3f, 0x46, 0x13, 0x1e, 0x71, 0x2b, 0x68, 0x61, 0x3a, 0xa3, 0x5b,
+  0x30, 0xd4, 0x09, 0x7e, 0xad, 0x69, 0x4b, 0xc6, 0x53, 0x3a, 0xf9, 0xbb, 0x7a, 0xb4, 0xad, 0x78,
+  0x1b, 0x33, 0x0c, 0x9a, 0x7b, 0xf9, 0xb6, 0xfb, 0x91, 0x44, 0x7e, 0x61, 0x28, 0xce, 0xcd, 0xd5,
+  0x76, 0x54, 0xb2, 0xd1, 0x6a, 0x1d, 0x7b, 0xda, 0x89, 0xc6, 0xff, 0x12, 0x3f, 0x21, 0x7c, 0xaa,
+  0xa8, 0x45, 0xfd, 0xf2, 0xf1, 0xcd, 0x2b, 0x9d, 0x66, 0x5a, 0x41, 0x37, 0xf8, 0x00, 0x28, 0xde,
+  0xef, 0x38, 0x86, 0x3a, 0x31, 0xe8, 0xb7, 0xf7, 0x95, 0xe7, 0x5a, 0xc8, 0xef, 0x05, 0xc1, 0x2a,
+  0xde, 0x75, 0x0c, 0x5e, 0xd6, 0x30, 0x78, 0x59, 0x68, 0xf5, 0x75, 0x18, 0xfc, 0xf9, 0xe2, 0xc3,
+  0xfb, 0x6e, 0x61, 0x3b, 0x93, 0x9c, 0x2c, 0x5b, 0x97, 0x27, 0x56, 0x77, 0x28, 0x7e, 0x17, 0xb7,
+  0xda, 0x38, 0x14, 0x5e, 0x76, 0xf1, 0x76, 0xa7, 0xf4, 0xfa, 0x30, 0x04, 0xc9, 0x97, 0x5d, 0xb7,
+  0xf4, 0xd2, 0x0f, 0xfa, 0x77, 0xd0, 0x6e, 0xcf, 0x44, 0x10, 0xe7, 0x16, 0xee, 0xa0, 0xda, 0x9a,
+  0x8a, 0x40, 0x64, 0xdf, 0xef, 0xa2, 0xa9, 0x8f, 0x45, 0x44, 0x43, 0xef, 0xf7, 0xd0, 0xb0, 0x3e,
+  0x1c, 0x81, 0x8c, 0x5e, 0xef, 0x41, 0xb5, 0x99, 0x91, 0x40, 0xa3, 0x92, 0x3b, 0x76, 0xef, 0x8e,
+  0x47, 0xd6, 0x87, 0xd5, 0xe2, 0x7d, 0x74, 0xac, 0x5f, 0xf9, 0x6e, 0x31, 0x41, 0xf4, 0x46, 0x18,
+  0xa1, 0x5e, 0xe2, 0x27, 0xb8, 0x4f, 0x2c, 0x0f, 0x66, 0xf6, 0x03, 0x65, 0xd7, 0xcb, 0x80, 0x4d,
+  0xe4, 0xcb, 0xee, 0x66, 0xcc, 0x7a, 0x14, 0x86, 0x73, 0x15, 0x8b, 0x09, 0x4e, 0x03, 0x71, 0xfb,
+  0x21, 0x73, 0x59, 0x58, 0xe7, 0x52, 0x63, 0x4d, 0x69, 0x73, 0x4f, 0xa6, 0xbb, 0x73, 0x62, 0xe8,
+  0xa8, 0xbf, 0xa5, 0x3c, 0xbb, 0x7c, 0xff, 0xa2, 0x3e, 0x6f, 0x15, 0x7f, 0x1c, 0xcd, 0xca, 0xe3,
+  0xcc, 0x59, 0xcf, 0xfe, 0x33, 0x24, 0x8e, 0x9f, 0xf6, 0xbf, 0x90, 0xfc, 0x1b, 0xdd, 0x2b, 0x17,
+  0xdc, 0x54, 0x22, 0x00, 0x00
+};
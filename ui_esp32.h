@@ -0,0 +1,153 @@
+// Generated by tools/gzip_ui.py from INDEX_HTML in esp32.ino — do not edit; re-run the script after UI changes
+// 6932 bytes -> 2310 bytes gzip
+#pragma once
+
+#define INDEX_HTML_HASH 0xd5519fabu  // FNV-1a of the uncompressed page
+
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x59, 0xdb, 0x72, 0xda, 0x48,
+  0x1a, 0xbe, 0xe7, 0x29, 0x7a, 0x94, 0x9a, 0x02, 0x76, 0x10, 0x20, 0x9c, 0xc9, 0x41, 0x20, 0x66,
+  0x92, 0x94, 0x2f, 0x32, 0x9b, 0x49, 0x5c, 0x71, 0xb6, 0x52, 0x5b, 0x5b, 0x7b, 0xd1, 0x48, 0x2d,
+  0xd4, 0xb6, 0xd4, 0xad, 0xea, 0x6e, 0x19, 0xb3, 0x8c, 0xab, 0xe6, 0x1d, 0x76, 0x9f, 0x70, 0x9e,
+  0x64, 0xff, 0xbf, 0x5b, 0x02, 0x41, 0x6c, 0x6c, 0x27, 0x7b, 0xb8, 0x88, 0xa1, 0x0f, 0xff, 0xf9,
+  0xfb, 0x0f, 0x4d, 0x3a, 0xb3, 0xef, 0x12, 0x19, 0x9b, 0x75, 0xc9, 0x48, 0x66, 0x8a, 0x7c, 0xde,
+  0x99, 0xe1, 0x07, 0xc9, 0xa9, 0x58, 0x46, 0x1e, 0x13, 0xde, 0x7c, 0x96, 0x31, 0x9a, 0xcc, 0x67,
+  0x05, 0x33, 0x94, 0xc4, 0x19, 0x55, 0x9a, 0x99, 0xc8, 0xab, 0x4c, 0xea, 0xbf, 0xf0, 0x46, 0xf5,
+  0xb6, 0xa0, 0x05, 0x8b, 0xbc, 0x2b, 0xce, 0x56, 0xa5, 0x54, 0xc6, 0x23, 0xb1, 0x14, 0x86, 0x09,
+  0xb8, 0xb6, 0xe2, 0x89, 0xc9, 0xa2, 0x84, 0x5d, 0xf1, 0x98, 0xf9, 0x76, 0x31, 0xe0, 0x82, 0x1b,
+  0x4e, 0x73, 0x5f, 0xc7, 0x34, 0x67, 0x51, 0x00, 0x3c, 0x3a, 0x33, 0xc3, 0x4d, 0xce, 0xe6, 0xa7,
+  0xe7, 0x67, 0x27, 0x13, 0xf2, 0xfa, 0xdd, 0x29, 0xf9, 0xb4, 0x2e, 0xb9, 0x36, 0xb3, 0x91, 0xdb,
+  0xef, 0xcc, 0xb4, 0x59, 0xe3, 0x67, 0xa8, 0xa4, 0x34, 0x1b, 0xdf, 0x5f, 0x2c, 0xc3, 0x27, 0xe3,
+  0xc5, 0x38, 0x0d, 0x9e, 0x4e, 0x7d, 0x3f, 0xa6, 0x2a, 0x09, 0x9f, 0x04, 0x93, 0xe0, 0xc5, 0x24,
+  0x80, 0x65, 0x51, 0x19, 0x06, 0x6b, 0xfa, 0x7c, 0x11, 0xc4, 0x13, 0x58, 0xd3, 0x38, 0x0e, 0x9f,
+  0x3c, 0x5d, 0x2c, 0x4e, 0xd2, 0xe4, 0xa6, 0xf3, 0xa7, 0xcd, 0x42, 0x5e, 0xfb, 0x9a, 0xff, 0x83,
+  0x8b, 0x65, 0xb8, 0x90, 0x2a, 0x61, 0xca, 0x87, 0x9d, 0x9b, 0xce, 0x42, 0x26, 0xeb, 0x4d, 0x41,
+  0xd5, 0x92, 0x8b, 0x30, 0x98, 0x94, 0xd7, 0xd3, 0x14, 0x2c, 0xf0, 0x53, 0x5a, 0xf0, 0x7c, 0x1d,
+  0xbe, 0x05, 0x63, 0xd4, 0x40, 0xaf, 0xb5, 0x61, 0x85, 0x5f, 0xf1, 0xc1, 0x2b, 0x05, 0xfa, 0x0f,
+  0x34, 0x15, 0xda, 0xd7, 0x4c, 0xf1, 0x74, 0xba, 0xa0, 0xf1, 0xe5, 0x52, 0xc9, 0x4a, 0x24, 0x5b,
+  0xbd, 0x62, 0x99, 0x4b, 0x15, 0x3e, 0x61, 0xcf, 0x58, 0x92, 0x3e, 0xbb, 0xe9, 0x0c, 0xd1, 0x23,
+  0x94, 0x0b, 0xa6, 0x40, 0xca, 0xb5, 0xf3, 0x44, 0x18, 0x04, 0xe3, 0x31, 0x88, 0xaa, 0xc5, 0x8e,
+  0x09, 0xad, 0x8c, 0x9c, 0x26, 0x5c, 0x97, 0x39, 0x5d, 0x87, 0x4b, 0xc5, 0x93, 0x29, 0xfe, 0xf1,
+  0x41, 0x2a, 0xec, 0x18, 0xe6, 0x03, 0xcf, 0xaa, 0x10, 0x3a, 0x0c, 0x52, 0x35, 0x5d, 0xd2, 0x32,
+  0x0c, 0x9e, 0x96, 0xa0, 0xfa, 0xcf, 0x05, 0x4b, 0x38, 0xed, 0x15, 0x5c, 0xd4, 0x6c, 0x5f, 0xbe,
+  0x00, 0xae, 0xfd, 0x4d, 0x4b, 0xe4, 0x9d, 0x6c, 0xc8, 0x09, 0xde, 0xbd, 0x41, 0xfd, 0xc0, 0x8b,
+  0x9b, 0x96, 0x1d, 0x57, 0x54, 0xf5, 0x9c, 0x6f, 0xfb, 0xd3, 0xda, 0x51, 0x8a, 0x26, 0xbc, 0xd2,
+  0xce, 0x3d, 0x25, 0x4d, 0x12, 0xf4, 0xa1, 0x5d, 0xb8, 0xf3, 0x30, 0x28, 0xaf, 0x89, 0x96, 0x39,
+  0x4f, 0xc8, 0x93, 0xe0, 0xf9, 0x64, 0x3c, 0x79, 0x7e, 0xd3, 0xc9, 0xe9, 0x82, 0xe5, 0x9b, 0xc6,
+  0xa4, 0x45, 0x2e, 0xe3, 0xcb, 0xda, 0x33, 0x8e, 0xbf, 0x0d, 0x56, 0xdf, 0x39, 0x1b, 0xa2, 0xc2,
+  0xc2, 0xe0, 0x64, 0xeb, 0x10, 0x08, 0x8c, 0x31, 0xb2, 0x08, 0x9f, 0xa1, 0x91, 0x5c, 0x94, 0x95,
+  0xf9, 0x1b, 0x82, 0x34, 0x12, 0x55, 0xb1, 0x60, 0xea, 0xef, 0x03, 0xcd, 0x72, 0x16, 0x9b, 0x81,
+  0x61, 0xd7, 0x86, 0x2a, 0x46, 0x37, 0xb5, 0x4f, 0xc7, 0xe3, 0xef, 0xb7, 0xda, 0xbd, 0xd8, 0x2a,
+  0xd7, 0x28, 0xff, 0xe2, 0x56, 0x75, 0x27, 0x93, 0x93, 0xf1, 0x09, 0xdd, 0x0f, 0xe3, 0xf3, 0x60,
+  0x1c, 0xbc, 0x38, 0x0c, 0xe3, 0x56, 0x18, 0x7a, 0x3b, 0x63, 0x7c, 0x99, 0x99, 0x70, 0x32, 0x19,
+  0x1f, 0xe0, 0xa5, 0xe2, 0x7e, 0x21, 0x85, 0xd4, 0x25, 0x8d, 0xd9, 0xe0, 0x8d, 0x14, 0x20, 0x85,
+  0xea, 0xc1, 0x76, 0x6b, 0xba, 0xca, 0x38, 0x84, 0xc1, 0x7e, 0x0f, 0x4b, 0xc5, 0xa6, 0xf2, 0x8a,
+  0xa9, 0x34, 0x97, 0x2b, 0x7f, 0xa5, 0x20, 0xaa, 0x42, 0xaa, 0x82, 0xe6, 0x10, 0x12, 0x25, 0x57,
+  0x9b, 0x7d, 0x57, 0x04, 0x18, 0x2c, 0x87, 0x25, 0x25, 0x73, 0xbd, 0x75, 0x6c, 0x9a, 0xb3, 0x6b,
+  0x8b, 0x08, 0x34, 0x0f, 0x17, 0x8e, 0x13, 0xfe, 0x01, 0x68, 0x57, 0x40, 0x2b, 0x36, 0x2d, 0x9f,
+  0x90, 0x56, 0xd4, 0x1a, 0xc7, 0xbc, 0x7c, 0xf9, 0x72, 0xe7, 0x1a, 0x21, 0x05, 0x9b, 0x7e, 0x01,
+  0x06, 0xc8, 0xa4, 0x7e, 0xe3, 0x10, 0xeb, 0x9e, 0x97, 0xce, 0xea, 0x95, 0xf3, 0xc3, 0xf3, 0xf1,
+  0x78, 0x1a, 0x57, 0x4a, 0xc3, 0x71, 0x29, 0x39, 0xa6, 0x4c, 0x23, 0x7b, 0xb8, 0xcc, 0xa4, 0x36,
+  0x6d, 0x74, 0x19, 0x05, 0xc9, 0x53, 0x82, 0x27, 0x85, 0xb9, 0x3b, 0x1c, 0x87, 0x29, 0xa4, 0x0d,
+  0x35, 0x95, 0xde, 0x3c, 0xc6, 0xd3, 0xb7, 0x44, 0x74, 0x8b, 0xdc, 0xf1, 0x03, 0xc1, 0x11, 0x40,
+  0x80, 0x27, 0x56, 0x3e, 0x84, 0x25, 0xdf, 0xb4, 0xb0, 0x8a, 0x5e, 0xfc, 0x12, 0xcd, 0x37, 0x9d,
+  0xd9, 0xa8, 0xae, 0x57, 0xb3, 0x91, 0x2b, 0x9d, 0x58, 0x5d, 0x60, 0x95, 0xf0, 0x2b, 0x12, 0x83,
+  0x82, 0x3a, 0xf2, 0xb6, 0xb9, 0xe9, 0xcd, 0x3b, 0x84, 0xec, 0x9d, 0x40, 0xca, 0xd9, 0x4d, 0xd8,
+  0xce, 0x82, 0x5b, 0x6a, 0x22, 0x6c, 0xba, 0xd3, 0x16, 0x11, 0x40, 0xa5, 0xa6, 0x81, 0x7d, 0x9b,
+  0x74, 0xc4, 0x96, 0xce, 0xc8, 0x3b, 0xa3, 0x50, 0xb5, 0x88, 0x54, 0xc4, 0x16, 0x78, 0x93, 0xc1,
+  0x3f, 0xc0, 0x30, 0x59, 0xcb, 0x8a, 0xac, 0xa8, 0x30, 0x76, 0xc7, 0xc9, 0x30, 0x92, 0x68, 0x26,
+  0x12, 0x42, 0x35, 0xb9, 0x64, 0xeb, 0x85, 0x04, 0x3d, 0x88, 0x4d, 0x3b, 0x6f, 0xfe, 0x09, 0x49,
+  0xe0, 0x1c, 0x79, 0xcc, 0x46, 0x96, 0xff, 0x56, 0x5a, 0x93, 0x12, 0x84, 0x27, 0x91, 0x87, 0x0b,
+  0x8f, 0x00, 0x26, 0x63, 0x96, 0xc9, 0x1c, 0x1c, 0xd9, 0x28, 0x00, 0xf2, 0x14, 0x74, 0x85, 0xc4,
+  0xa9, 0x82, 0xec, 0x32, 0xa6, 0xd8, 0x70, 0x38, 0x84, 0xf6, 0x32, 0x6a, 0x58, 0xd4, 0x76, 0x8d,
+  0xc0, 0xb0, 0x5b, 0x4d, 0x24, 0x0d, 0xf0, 0x77, 0xb6, 0x3a, 0x80, 0x11, 0x29, 0xe2, 0x9c, 0xc7,
+  0x97, 0x91, 0x87, 0x16, 0xa0, 0xb6, 0xbd, 0xbe, 0xd7, 0x78, 0xe0, 0x1c, 0x8d, 0xda, 0x1a, 0x8e,
+  0x56, 0xc0, 0xf7, 0x92, 0x72, 0xc5, 0x12, 0xe2, 0x1a, 0x13, 0x18, 0x88, 0xce, 0x01, 0x3e, 0xa0,
+  0xc6, 0x92, 0x81, 0x8f, 0x1d, 0xdb, 0x43, 0x29, 0xb5, 0x26, 0x16, 0xcd, 0xde, 0x4e, 0x26, 0x2d,
+  0xcb, 0x7c, 0x0d, 0xe0, 0x4b, 0xf9, 0xb2, 0x25, 0xf6, 0x15, 0xee, 0x12, 0x48, 0x08, 0x04, 0x39,
+  0x78, 0xd6, 0x18, 0x40, 0x1d, 0x68, 0xee, 0xf6, 0x9b, 0xf5, 0x23, 0x45, 0x81, 0x72, 0xe7, 0x36,
+  0x0b, 0x5a, 0x82, 0x3e, 0xb2, 0x54, 0x31, 0x9d, 0x11, 0x97, 0x1e, 0x24, 0x55, 0xb2, 0x70, 0x11,
+  0xf5, 0xe6, 0xee, 0xee, 0x23, 0x65, 0x68, 0x23, 0x4b, 0xc4, 0x9a, 0x68, 0x5b, 0xf3, 0xb6, 0xb0,
+  0x5d, 0xc6, 0x30, 0xd4, 0x1d, 0x2e, 0x10, 0x2a, 0x00, 0x1c, 0x7e, 0xa9, 0xe4, 0x12, 0x84, 0x6b,
+  0x44, 0x06, 0x10, 0x90, 0x0b, 0xb9, 0x00, 0xa9, 0x9f, 0x3e, 0x9c, 0x7d, 0x21, 0xf3, 0x3b, 0xdf,
+  0x27, 0x67, 0x50, 0xab, 0x46, 0x67, 0xb4, 0xd2, 0x8c, 0xd4, 0x2a, 0xf8, 0xfe, 0x71, 0xa5, 0x10,
+  0x53, 0x58, 0xe1, 0x4a, 0x24, 0x6a, 0xe9, 0x68, 0xe4, 0x72, 0x99, 0x33, 0xcb, 0xaa, 0xa5, 0xa4,
+  0x63, 0x0d, 0x00, 0x03, 0x95, 0xaa, 0x82, 0xd5, 0x4a, 0x79, 0xf3, 0x9d, 0xdc, 0x7d, 0xb5, 0xee,
+  0x46, 0x1a, 0xa0, 0xb2, 0xb5, 0xe1, 0x3c, 0xeb, 0xb4, 0xa9, 0xbf, 0xcf, 0x3f, 0x42, 0x62, 0xaf,
+  0x87, 0x8e, 0xc3, 0x96, 0x4f, 0xfd, 0xe5, 0x58, 0x46, 0x4f, 0xe6, 0xaf, 0x59, 0x46, 0xaf, 0xb8,
+  0x54, 0x90, 0xc9, 0x93, 0xc7, 0x64, 0xf2, 0x67, 0xa8, 0x4c, 0x9a, 0x94, 0x4c, 0x11, 0x68, 0x3e,
+  0x50, 0x69, 0x2c, 0x8e, 0x1d, 0x80, 0xc9, 0x8a, 0xe7, 0x39, 0xa1, 0xbc, 0x20, 0xa9, 0x84, 0x8a,
+  0xf2, 0xf9, 0xec, 0x57, 0xd2, 0x0b, 0xc6, 0x7f, 0xfc, 0xfe, 0xcf, 0x93, 0xf1, 0xb8, 0x7f, 0x98,
+  0xb0, 0x36, 0xa7, 0xad, 0x2d, 0xab, 0xb2, 0xf0, 0x6c, 0x4e, 0x47, 0x9e, 0x6b, 0xaa, 0x1e, 0xb2,
+  0x8e, 0xbc, 0x60, 0x0c, 0x5f, 0xe8, 0x75, 0xe4, 0x01, 0xb9, 0x47, 0xae, 0x68, 0x5e, 0x31, 0xdc,
+  0x84, 0xef, 0xa3, 0x3d, 0xc7, 0x3d, 0x42, 0xf9, 0x73, 0xa3, 0x78, 0x6c, 0x48, 0x81, 0x15, 0x00,
+  0xba, 0x16, 0x5d, 0xe4, 0x4c, 0x13, 0xc8, 0x47, 0x05, 0xd5, 0xa6, 0x67, 0xa3, 0xab, 0x07, 0xa8,
+  0x8a, 0xd4, 0x7d, 0x80, 0x56, 0x82, 0xb6, 0x68, 0x34, 0x06, 0xee, 0x50, 0xa0, 0x33, 0xbc, 0xb0,
+  0x91, 0xac, 0xd9, 0x80, 0x81, 0x87, 0x56, 0xb9, 0x69, 0xa0, 0x0e, 0x11, 0x5e, 0x82, 0x10, 0xca,
+  0xd2, 0x70, 0x80, 0x54, 0x6d, 0xc0, 0xd8, 0x9b, 0x7f, 0x48, 0xd3, 0xd9, 0xc8, 0xed, 0x1e, 0x9e,
+  0x06, 0x70, 0x2a, 0x76, 0x87, 0x23, 0xc7, 0xef, 0x6b, 0xcd, 0xfd, 0x08, 0x36, 0x40, 0x1a, 0x3a,
+  0xb5, 0x41, 0x04, 0x0c, 0x8c, 0x56, 0x18, 0x17, 0x18, 0xc0, 0x18, 0x2b, 0xc2, 0x1f, 0xbf, 0xff,
+  0x8b, 0x64, 0xd0, 0x38, 0x21, 0x9e, 0x11, 0xf8, 0x45, 0xc1, 0xf4, 0x5d, 0x15, 0x54, 0xf8, 0x39,
+  0xbf, 0x64, 0xe4, 0x82, 0x1b, 0x83, 0xbd, 0xe1, 0x17, 0xfb, 0x49, 0x7a, 0xdf, 0x1f, 0x89, 0x62,
+  0x7d, 0xf7, 0xb6, 0x40, 0xfe, 0x58, 0xc7, 0xf1, 0xe9, 0x8f, 0xbb, 0x30, 0x4e, 0xbe, 0x21, 0x8a,
+  0x6f, 0x32, 0x2a, 0x00, 0x6d, 0xbd, 0x00, 0x0d, 0x79, 0xdf, 0x07, 0x04, 0x52, 0x43, 0x28, 0x7c,
+  0x70, 0x71, 0x89, 0x86, 0x96, 0x2e, 0x01, 0x63, 0x1c, 0x03, 0x08, 0x4d, 0x51, 0x75, 0x4a, 0x6c,
+  0x27, 0xb6, 0xe6, 0x42, 0xd1, 0x23, 0x63, 0xac, 0xc0, 0x35, 0x02, 0xa0, 0xee, 0xee, 0x53, 0x36,
+  0x8c, 0xef, 0x36, 0xd6, 0x8a, 0xba, 0xd5, 0xd6, 0x06, 0xb3, 0x41, 0x0b, 0xb3, 0xdf, 0x82, 0xd8,
+  0x53, 0x81, 0x2a, 0x12, 0xcd, 0x8b, 0x0a, 0xa7, 0xe6, 0xc4, 0xa1, 0xd3, 0x82, 0x33, 0x96, 0x50,
+  0xd4, 0x63, 0x0c, 0x28, 0x14, 0x82, 0xfa, 0x9e, 0x3d, 0x3d, 0x02, 0x4a, 0x7b, 0xee, 0xdd, 0x82,
+  0xba, 0xbf, 0x32, 0x7d, 0x17, 0x26, 0x01, 0xb1, 0xef, 0xe5, 0x7f, 0x0c, 0x93, 0xb5, 0xa2, 0x10,
+  0x1d, 0xaa, 0x81, 0x1f, 0x85, 0x27, 0x9e, 0x14, 0x4b, 0x08, 0xd1, 0x7e, 0xf8, 0xc0, 0x44, 0xe3,
+  0x62, 0xb6, 0x33, 0x0e, 0x2f, 0xd6, 0xa7, 0x47, 0x4c, 0xcc, 0x4b, 0xfb, 0x5a, 0xfc, 0xff, 0x59,
+  0xf8, 0x39, 0x63, 0x82, 0x30, 0x11, 0xc3, 0xbc, 0x07, 0xd0, 0x43, 0x8b, 0x04, 0x5b, 0xe5, 0x30,
+  0x65, 0xe9, 0x10, 0x46, 0x1a, 0x56, 0x92, 0x53, 0xdc, 0x27, 0x23, 0xe8, 0x0f, 0x76, 0x44, 0x81,
+  0xb2, 0x69, 0xb2, 0x1a, 0x9f, 0xb8, 0x59, 0xc0, 0x20, 0x0e, 0x0a, 0x39, 0x1a, 0x02, 0x58, 0x4f,
+  0xe0, 0xcb, 0xf2, 0x88, 0xc5, 0x22, 0xbf, 0xad, 0xca, 0xfc, 0x79, 0x2b, 0xea, 0xee, 0x62, 0x43,
+  0x1c, 0x17, 0x96, 0x40, 0x23, 0x39, 0xd4, 0xe5, 0x2e, 0xaa, 0x09, 0x76, 0x1d, 0xd4, 0xf1, 0x21,
+  0x0e, 0xcb, 0x14, 0xb1, 0x43, 0x68, 0xe4, 0xd5, 0x33, 0x6e, 0x3d, 0x4d, 0xbb, 0x97, 0x99, 0xcd,
+  0x8b, 0x6d, 0x47, 0x7a, 0x83, 0x55, 0xd9, 0x96, 0xe6, 0x1e, 0xc0, 0xbd, 0xcc, 0x59, 0xff, 0xb1,
+  0xbd, 0x69, 0x97, 0x2c, 0x40, 0x4d, 0x2c, 0xbf, 0x5f, 0x2d, 0x3f, 0xbe, 0x14, 0x58, 0xda, 0x1c,
+  0x9e, 0x2c, 0xb2, 0x60, 0xc4, 0x32, 0x44, 0xa6, 0x04, 0x7d, 0xdc, 0xf7, 0xe6, 0xdb, 0xbb, 0x47,
+  0xdc, 0x8c, 0x73, 0x23, 0xaa, 0xf7, 0x3f, 0x28, 0xe9, 0x76, 0xc6, 0x87, 0x0e, 0x8a, 0x48, 0xda,
+  0x99, 0xc1, 0x35, 0xf9, 0xf0, 0xde, 0xcd, 0x90, 0x76, 0x08, 0x77, 0xfd, 0x56, 0x5f, 0xf2, 0x92,
+  0xbc, 0x7a, 0xf7, 0x8e, 0xe4, 0x30, 0x0b, 0x20, 0xda, 0xec, 0xbb, 0xce, 0xc1, 0x89, 0xba, 0xc9,
+  0x7a, 0x6b, 0x2d, 0xa3, 0x71, 0x66, 0x4d, 0x06, 0x17, 0x5b, 0x5f, 0x40, 0xb7, 0xa3, 0x0b, 0xf8,
+  0xcb, 0x4c, 0x3c, 0xec, 0x0f, 0x49, 0x0d, 0x3a, 0x70, 0x11, 0x78, 0x0b, 0xde, 0x84, 0x9a, 0xa9,
+  0x2b, 0x96, 0x0c, 0x0f, 0x27, 0x8b, 0x46, 0xed, 0x99, 0x8e, 0x15, 0x2f, 0xc1, 0x16, 0xaa, 0xd7,
+  0x22, 0x26, 0x69, 0x25, 0x6c, 0x39, 0x22, 0x7b, 0xa3, 0xe8, 0x06, 0xe8, 0x60, 0x62, 0x06, 0x75,
+  0x4b, 0x68, 0x31, 0x90, 0x0a, 0xe4, 0x2f, 0x1f, 0xdf, 0x9d, 0x33, 0xaa, 0xe2, 0xec, 0x8c, 0x2a,
+  0x5a, 0xe8, 0xde, 0xc6, 0xda, 0x0f, 0x63, 0x40, 0x48, 0x12, 0x19, 0xc3, 0xc8, 0x24, 0xcc, 0x10,
+  0x46, 0xcc, 0xd3, 0x9c, 0xe1, 0xd7, 0xd7, 0xeb, 0xb7, 0x49, 0xaf, 0x0b, 0xa7, 0xdd, 0xfe, 0xd0,
+  0xba, 0x74, 0x60, 0xaf, 0xbb, 0xf6, 0x7a, 0x84, 0xc2, 0x5d, 0xd8, 0x27, 0x72, 0x4d, 0xea, 0x08,
+  0x91, 0xbb, 0xb0, 0x4f, 0x64, 0x0b, 0xd3, 0x11, 0x1a, 0x7b, 0x7e, 0x40, 0x82, 0x65, 0xf6, 0x18,
+  0x09, 0x9e, 0xef, 0x93, 0x60, 0xd9, 0x3a, 0x42, 0x81, 0xc7, 0xfb, 0x04, 0x22, 0x3f, 0x72, 0x5d,
+  0xe4, 0xfb, 0x97, 0x1b, 0xec, 0x1e, 0x21, 0x69, 0xae, 0x34, 0x84, 0x40, 0x77, 0xd3, 0x9f, 0x6e,
+  0x83, 0x87, 0xf3, 0x01, 0x5d, 0x51, 0x6e, 0x48, 0x0a, 0x60, 0xc9, 0x7a, 0xdd, 0x51, 0x6c, 0x03,
+  0xfc, 0x53, 0x97, 0xfc, 0x40, 0xca, 0xa1, 0x91, 0x38, 0x14, 0xe1, 0xb0, 0xde, 0xa2, 0x31, 0x5b,
+  0x1a, 0x35, 0x34, 0xf6, 0x39, 0x84, 0x67, 0x47, 0x22, 0x86, 0x43, 0x2d, 0xc8, 0xe7, 0x02, 0x9e,
+  0xa4, 0xf6, 0xb5, 0x17, 0x11, 0x33, 0xed, 0xdc, 0x74, 0x0e, 0x01, 0xb6, 0x7b, 0x5f, 0x21, 0x76,
+  0x9c, 0x88, 0x3d, 0xd0, 0xed, 0x74, 0x48, 0xa8, 0xa1, 0xc0, 0xe6, 0xee, 0x50, 0x00, 0x9b, 0xc6,
+  0x64, 0xa4, 0xe2, 0x69, 0xef, 0x3b, 0x4b, 0xf3, 0xdb, 0x6f, 0x96, 0x76, 0x08, 0x66, 0x15, 0xbd,
+  0x7e, 0x14, 0x45, 0xdd, 0x6e, 0x7f, 0xf3, 0x18, 0xe5, 0xa3, 0xee, 0x7b, 0x89, 0xd8, 0x58, 0x36,
+  0x6f, 0xda, 0xee, 0x14, 0xaa, 0xbb, 0xa9, 0x94, 0x98, 0x92, 0x9b, 0xc7, 0xf9, 0x21, 0xea, 0xe2,
+  0xf3, 0x11, 0x58, 0xc1, 0x53, 0xb5, 0x8b, 0x5a, 0x1a, 0xb5, 0xde, 0xd4, 0x81, 0xbd, 0x3d, 0x38,
+  0x38, 0x9a, 0x74, 0x07, 0x64, 0x53, 0x30, 0x93, 0xc9, 0x24, 0xec, 0x9e, 0x7d, 0x38, 0xff, 0x04,
+  0x6b, 0xfc, 0x21, 0x80, 0x29, 0x1d, 0x6e, 0xba, 0x6f, 0xdc, 0x6f, 0xa3, 0x3e, 0xbe, 0x39, 0xbb,
+  0xa1, 0x75, 0xc3, 0x08, 0x5a, 0x00, 0x17, 0xdd, 0x9b, 0x01, 0xc1, 0x5f, 0x0a, 0x42, 0xb4, 0xde,
+  0x21, 0xe0, 0x78, 0x3c, 0xbf, 0x22, 0xa2, 0x00, 0xad, 0x98, 0xa2, 0xa2, 0xec, 0x71, 0x2e, 0x05,
+  0xea, 0xee, 0xa9, 0x52, 0xd0, 0x41, 0x48, 0xf7, 0x07, 0x06, 0x5e, 0xbc, 0x05, 0x1a, 0xad, 0x77,
+  0xe3, 0xa6, 0xf6, 0xd4, 0x9d, 0x5e, 0xc2, 0xcb, 0xdd, 0xfe, 0xf4, 0x6e, 0xf3, 0x1e, 0x6d, 0x1a,
+  0x69, 0xbd, 0x8d, 0xa7, 0xdf, 0x60, 0xe5, 0x39, 0xbe, 0x6e, 0x19, 0x9a, 0xda, 0x9d, 0x3a, 0x3b,
+  0x47, 0x23, 0xe2, 0xde, 0x9b, 0x6e, 0x04, 0x1a, 0xb9, 0xd7, 0xe5, 0xa1, 0xf9, 0x7b, 0x4f, 0xd2,
+  0xcd, 0x43, 0x90, 0x62, 0xb9, 0x75, 0xff, 0x5b, 0x71, 0x26, 0x7b, 0x0e, 0xf9, 0xea, 0xc0, 0x47,
+  0x5d, 0xf7, 0xaa, 0x66, 0xc7, 0x83, 0xdf, 0x92, 0xf5, 0x20, 0xdb, 0x1b, 0x41, 0x6d, 0xe3, 0x2f,
+  0x5a, 0xc6, 0x5f, 0x68, 0x29, 0xbe, 0xce, 0xf8, 0x5f, 0xce, 0x3f, 0xbc, 0x1f, 0x6a, 0x5b, 0x12,
+  0x79, 0xba, 0xee, 0x5d, 0x0c, 0x88, 0xa8, 0xf2, 0x7c, 0x40, 0x26, 0xf7, 0x71, 0x6b, 0x35, 0xba,
+  0xe8, 0x62, 0x08, 0xab, 0x7b, 0xa5, 0xb7, 0xdb, 0x1c, 0x48, 0xbe, 0x18, 0xba, 0xad, 0x9f, 0x82,
+  0x70, 0x7c, 0x0f, 0xed, 0x7e, 0xb7, 0x03, 0x71, 0x6e, 0xe3, 0x1e, 0xaa, 0xbd, 0x7e, 0x07, 0x44,
+  0x76, 0x7d, 0x1f, 0x4d, 0xbb, 0xe1, 0x21, 0x0d, 0xae, 0x1f, 0xa0, 0x61, 0xbb, 0xed, 0x01, 0x19,
+  0x2e, 0x1f, 0x40, 0xb5, 0xeb, 0x7e, 0x40, 0x23, 0xf2, 0x7b, 0x6e, 0x1f, 0x36, 0x3e, 0xeb, 0xc3,
+  0x66, 0xb3, 0x91, 0xf6, 0xb5, 0xb0, 0x75, 0x70, 0xfc, 0x02, 0xb7, 0x7b, 0x49, 0x01, 0x33, 0x61,
+  0x3d, 0x47, 0xcd, 0x46, 0xf6, 0x37, 0x5a, 0x98, 0x7b, 0xed, 0x7f, 0x81, 0xfd, 0x1b, 0x6a, 0xaa,
+  0x5f, 0xbe, 0x14, 0x1b, 0x00, 0x00
+};
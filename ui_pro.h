@@ -0,0 +1,303 @@
+// Generated by tools/gzip_ui.py from INDEX_HTML in pro(beta).cpp — do not edit; re-run the script after UI changes
+// 15366 bytes -> 4709 bytes gzip
+#pragma once
+
+#define INDEX_HTML_HASH 0x08d07c91u  // FNV-1a of the uncompressed page
+
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x3b, 0x6d, 0x72, 0xdb, 0xc6,
+  0x92, 0xff, 0x75, 0x8a, 0x79, 0x74, 0x39, 0x00, 0x24, 0x12, 0x04, 0x28, 0x5b, 0x92, 0xc1, 0x0f,
+  0x25, 0x76, 0x94, 0x8a, 0x5f, 0xfc, 0xa1, 0x8a, 0xe4, 0x4d, 0x65, 0x5d, 0xae, 0x57, 0x43, 0x60,
+  0x48, 0x8e, 0x04, 0x60, 0x60, 0x00, 0x14, 0xc5, 0xd0, 0xaa, 0xca, 0x1d, 0x76, 0xcf, 0xb0, 0x57,
+  0xd8, 0xff, 0x7b, 0x94, 0x9c, 0x64, 0xbb, 0x67, 0x06, 0x04, 0x40, 0x51, 0x24, 0x15, 0x27, 0xf5,
+  0x5c, 0x25, 0x0b, 0x18, 0x4c, 0xf7, 0xf4, 0xf7, 0x74, 0xf7, 0x8c, 0xf6, 0x7a, 0xff, 0x08, 0x84,
+  0x9f, 0xcf, 0x13, 0x46, 0x26, 0x79, 0x14, 0x0e, 0xf6, 0x7a, 0xf8, 0x8b, 0x84, 0x34, 0x1e, 0xf7,
+  0x1b, 0x2c, 0x6e, 0x0c, 0x7a, 0x13, 0x46, 0x83, 0x41, 0x2f, 0x62, 0x39, 0x25, 0xfe, 0x84, 0xa6,
+  0x19, 0xcb, 0xfb, 0x8d, 0x69, 0x3e, 0x6a, 0x9d, 0x34, 0xda, 0x7a, 0x38, 0xa6, 0x11, 0xeb, 0x37,
+  0x6e, 0x38, 0x9b, 0x25, 0x22, 0xcd, 0x1b, 0xc4, 0x17, 0x71, 0xce, 0x62, 0x98, 0x36, 0xe3, 0x41,
+  0x3e, 0xe9, 0x07, 0xec, 0x86, 0xfb, 0xac, 0x25, 0x5f, 0x9a, 0x3c, 0xe6, 0x39, 0xa7, 0x61, 0x2b,
+  0xf3, 0x69, 0xc8, 0xfa, 0x2e, 0xe0, 0xd8, 0xeb, 0xe5, 0x3c, 0x0f, 0xd9, 0xe0, 0xec, 0xe2, 0xfc,
+  0xb0, 0x43, 0x5e, 0xbe, 0x39, 0x23, 0x97, 0xf3, 0x84, 0x67, 0x39, 0xf9, 0xe3, 0xf7, 0xff, 0x26,
+  0xe7, 0xa9, 0xe8, 0xb5, 0xd5, 0xf7, 0xbd, 0x5e, 0x96, 0xcf, 0xf1, 0xb7, 0x97, 0x0a, 0x91, 0x2f,
+  0x5a, 0xad, 0xe1, 0xd8, 0x7b, 0xe2, 0x0c, 0x9d, 0x91, 0xfb, 0xac, 0xdb, 0x6a, 0xf9, 0x34, 0x0d,
+  0xbc, 0x27, 0x6e, 0xc7, 0x3d, 0xe9, 0xb8, 0xf0, 0x1a, 0x4d, 0x73, 0x06, 0xef, 0xf4, 0x78, 0xe8,
+  0xfa, 0x1d, 0x78, 0xa7, 0xbe, 0xef, 0x3d, 0x19, 0x1d, 0x0d, 0x3b, 0xee, 0xf0, 0x6e, 0x6f, 0x7f,
+  0x31, 0x14, 0xb7, 0xad, 0x8c, 0xff, 0xc6, 0xe3, 0xb1, 0x37, 0x14, 0x69, 0xc0, 0xd2, 0x16, 0x8c,
+  0xdc, 0xed, 0x0d, 0x45, 0x30, 0x5f, 0x44, 0x34, 0x1d, 0xf3, 0xd8, 0x73, 0x3b, 0xc9, 0x6d, 0x77,
+  0x04, 0x9c, 0xb4, 0x46, 0x34, 0xe2, 0xe1, 0xdc, 0x7b, 0x0d, 0x4c, 0xa5, 0xcd, 0x6c, 0x9e, 0xe5,
+  0x2c, 0x6a, 0x4d, 0x79, 0xf3, 0xbb, 0x14, 0xf8, 0x68, 0x66, 0x34, 0xce, 0x5a, 0x19, 0x4b, 0xf9,
+  0xa8, 0x3b, 0xa4, 0xfe, 0xf5, 0x38, 0x15, 0xd3, 0x38, 0xf0, 0x6e, 0x68, 0x6a, 0x22, 0x81, 0x56,
+  0xd7, 0x17, 0xa1, 0x48, 0xbd, 0x27, 0xec, 0x88, 0x05, 0xa3, 0xa3, 0xbb, 0x3d, 0x1b, 0x65, 0x43,
+  0x79, 0xcc, 0x52, 0x58, 0xe7, 0x56, 0xc9, 0x04, 0x96, 0x72, 0x1c, 0x58, 0x4c, 0x2f, 0xec, 0x10,
+  0x3a, 0xcd, 0x45, 0x37, 0xe0, 0x59, 0x12, 0xd2, 0xb9, 0x37, 0x4e, 0x79, 0xd0, 0xc5, 0xff, 0x5a,
+  0xb0, 0x2e, 0x8c, 0xe4, 0xac, 0x05, 0x38, 0xa7, 0x51, 0x9c, 0x79, 0xee, 0x28, 0xed, 0x8e, 0x69,
+  0xe2, 0xb9, 0xcf, 0x12, 0x20, 0xfe, 0xdb, 0x88, 0x05, 0x9c, 0x9a, 0x11, 0x8f, 0x0b, 0xb4, 0x2e,
+  0xa2, 0xb5, 0x16, 0x95, 0x35, 0x1f, 0xc4, 0x43, 0x9e, 0x75, 0x60, 0xee, 0x1d, 0x12, 0x08, 0x82,
+  0x5c, 0xdc, 0x63, 0x05, 0x47, 0xad, 0xae, 0x96, 0x55, 0x4a, 0x03, 0x3e, 0xcd, 0x94, 0x84, 0x12,
+  0x1a, 0x04, 0x28, 0x46, 0xa4, 0x41, 0x7f, 0xf7, 0xdc, 0xe4, 0x96, 0x64, 0x22, 0xe4, 0x01, 0x79,
+  0xe2, 0x1e, 0x77, 0x9c, 0xce, 0x31, 0xa0, 0x4d, 0xc5, 0x4c, 0x4b, 0x16, 0x44, 0x9d, 0xe7, 0x22,
+  0xf2, 0x5c, 0x5c, 0x50, 0x09, 0x24, 0x15, 0x61, 0xb6, 0x28, 0x18, 0x1e, 0x85, 0xec, 0x56, 0xb2,
+  0x75, 0x82, 0x0a, 0x80, 0x97, 0xd6, 0x2c, 0x85, 0x37, 0xfc, 0x0f, 0x34, 0x34, 0x05, 0xd8, 0x78,
+  0x51, 0xac, 0x0a, 0x53, 0x88, 0x24, 0xa3, 0x4e, 0xd9, 0x8b, 0x17, 0x2f, 0x4a, 0x6a, 0x62, 0x11,
+  0xb3, 0xfb, 0xba, 0x01, 0x83, 0x58, 0x2a, 0xc7, 0x39, 0x76, 0x1d, 0xf7, 0x85, 0x52, 0xf6, 0x8c,
+  0xf1, 0xf1, 0x24, 0xf7, 0x8e, 0x1d, 0xa7, 0xeb, 0x4f, 0xd3, 0x0c, 0x3e, 0x27, 0x82, 0xa3, 0xe6,
+  0x8b, 0xb5, 0xed, 0xf1, 0x44, 0x64, 0x79, 0x55, 0x42, 0x79, 0x0a, 0x36, 0x90, 0xd0, 0x14, 0x4c,
+  0x7e, 0x8d, 0x04, 0x3a, 0x9d, 0x43, 0xe7, 0x90, 0xae, 0xda, 0x01, 0x8f, 0x93, 0x69, 0xfe, 0x11,
+  0xdd, 0xae, 0x1f, 0x4f, 0xa3, 0x21, 0x4b, 0x3f, 0x35, 0x33, 0x16, 0x32, 0x3f, 0x6f, 0xe6, 0xec,
+  0x36, 0x07, 0x5c, 0x74, 0xa1, 0x95, 0xe8, 0x38, 0x4f, 0xbb, 0x15, 0x76, 0x57, 0x38, 0x3d, 0x59,
+  0x2b, 0x75, 0xbd, 0x66, 0x85, 0x46, 0xc5, 0xe3, 0xc9, 0x2a, 0x19, 0xcb, 0xc5, 0xd0, 0x6a, 0x26,
+  0x8a, 0x75, 0x65, 0x8c, 0x55, 0xcb, 0x9f, 0xf2, 0x56, 0x24, 0x62, 0x01, 0x3c, 0xfa, 0xac, 0xf9,
+  0x4a, 0xc4, 0xb0, 0x0a, 0xcd, 0x9a, 0xcb, 0xa1, 0xee, 0x6c, 0xc2, 0xc1, 0x9a, 0xe4, 0xb3, 0x97,
+  0xa4, 0xac, 0x2b, 0x6e, 0x58, 0x3a, 0x0a, 0xc5, 0x4c, 0x29, 0x2e, 0x16, 0x69, 0x44, 0x43, 0xd0,
+  0x34, 0x7c, 0xc2, 0x18, 0xb1, 0x58, 0x43, 0xd6, 0xd2, 0x8a, 0x9c, 0x1d, 0x39, 0x74, 0x3b, 0x60,
+  0x57, 0x47, 0xdd, 0x0a, 0xd9, 0xee, 0xb3, 0xc7, 0x92, 0x9d, 0x88, 0x0c, 0x62, 0x91, 0x88, 0xbd,
+  0x94, 0x81, 0x3b, 0xf0, 0x1b, 0x86, 0xd6, 0x28, 0x75, 0xbe, 0xb4, 0x45, 0x1e, 0x87, 0xe0, 0x37,
+  0xad, 0x61, 0x28, 0xfc, 0xeb, 0xae, 0x52, 0x08, 0xd2, 0x53, 0x2c, 0x69, 0x77, 0x58, 0xf4, 0x80,
+  0x69, 0x69, 0x5b, 0x0f, 0xd9, 0x08, 0x24, 0x0a, 0x20, 0x34, 0xe6, 0x11, 0x95, 0xab, 0x0d, 0x01,
+  0xe5, 0x35, 0x71, 0x33, 0x02, 0x81, 0x24, 0xc9, 0xcc, 0x8e, 0x45, 0x78, 0x3c, 0xc2, 0xb0, 0x08,
+  0xeb, 0x7f, 0x7b, 0xcd, 0xe6, 0xa3, 0x14, 0xc2, 0x69, 0x46, 0xe4, 0xb4, 0xc5, 0x73, 0xe7, 0xe9,
+  0x42, 0x00, 0xb5, 0x3c, 0x9f, 0x7b, 0xce, 0x9d, 0x14, 0xa2, 0x18, 0xa7, 0x2c, 0xcb, 0x16, 0x05,
+  0x0d, 0x52, 0x62, 0x55, 0x89, 0x0e, 0x51, 0x36, 0x2b, 0x42, 0x3c, 0x82, 0x49, 0x85, 0x56, 0xbc,
+  0x09, 0x0f, 0x02, 0x16, 0x57, 0x70, 0x91, 0x01, 0x09, 0xf8, 0x4d, 0x89, 0x11, 0x2c, 0xae, 0x82,
+  0x11, 0x25, 0x40, 0xd3, 0xd6, 0x18, 0x51, 0x81, 0x89, 0x9b, 0x2f, 0x9c, 0x80, 0x8d, 0x9b, 0x24,
+  0x1d, 0x0f, 0xa9, 0xd9, 0x79, 0x76, 0xd4, 0x74, 0x8f, 0x4f, 0x9a, 0x9d, 0xe3, 0xa6, 0x63, 0xbf,
+  0xb0, 0xf4, 0xe8, 0xf1, 0x73, 0x18, 0x7c, 0xd1, 0xec, 0x3c, 0x3f, 0x94, 0xa3, 0x96, 0x96, 0x9c,
+  0xf3, 0x14, 0xd6, 0xc4, 0xdd, 0x84, 0xa5, 0x75, 0x67, 0xa7, 0x21, 0x1f, 0xc7, 0x2d, 0x10, 0x40,
+  0x94, 0x79, 0x3e, 0x43, 0x67, 0x53, 0x61, 0xad, 0x23, 0x03, 0x84, 0x8c, 0xfe, 0x0b, 0xa9, 0x58,
+  0x08, 0xd9, 0xcc, 0x73, 0x4f, 0x0a, 0x3d, 0x6b, 0x5f, 0x3d, 0x71, 0x1c, 0x98, 0x96, 0x81, 0x91,
+  0x85, 0xd5, 0x69, 0x28, 0x75, 0x65, 0xee, 0x4a, 0x2d, 0x72, 0x4b, 0xb0, 0x94, 0x1d, 0xc2, 0x26,
+  0xb6, 0x83, 0x07, 0x07, 0x34, 0x9b, 0xb0, 0xd2, 0x9d, 0x0a, 0x23, 0x3d, 0x5a, 0x6b, 0xa3, 0xab,
+  0xd1, 0xc2, 0x1e, 0xc1, 0x2e, 0x05, 0x9c, 0x56, 0x28, 0x3a, 0x5c, 0x4b, 0x51, 0x61, 0x2a, 0xb9,
+  0x48, 0x10, 0xf5, 0xdd, 0x5e, 0xaf, 0xad, 0x37, 0xba, 0x5e, 0x5b, 0xed, 0xbd, 0xb8, 0x2d, 0xc1,
+  0x1b, 0xe8, 0x88, 0xf8, 0x60, 0xc2, 0x59, 0xbf, 0xb1, 0x8c, 0xe8, 0x8d, 0xc1, 0x1e, 0x21, 0xb5,
+  0x2f, 0x10, 0xa8, 0xe5, 0x60, 0x7d, 0x58, 0x89, 0x5d, 0x7f, 0xa8, 0x7f, 0x92, 0xf2, 0x6d, 0x6c,
+  0xd8, 0x7e, 0x61, 0xee, 0x3a, 0x38, 0x29, 0xf0, 0xc6, 0xe0, 0x67, 0x06, 0xea, 0xcb, 0x72, 0xee,
+  0x13, 0x88, 0x66, 0x20, 0x1e, 0x02, 0x56, 0x35, 0xe2, 0x21, 0xcb, 0x9a, 0x24, 0xe7, 0xe0, 0x9f,
+  0x60, 0x2a, 0x34, 0x0e, 0x48, 0x08, 0xfe, 0x45, 0x74, 0x04, 0xa8, 0xa0, 0xd4, 0x8f, 0xf7, 0xe8,
+  0x85, 0xed, 0xa2, 0x24, 0x36, 0xa4, 0x43, 0x16, 0x0e, 0x2e, 0x21, 0x56, 0x91, 0x5c, 0xe0, 0x32,
+  0xac, 0xd7, 0x56, 0x63, 0xc5, 0x8c, 0x22, 0x8e, 0x11, 0x1e, 0x00, 0x43, 0xf0, 0xd2, 0x20, 0x60,
+  0x5e, 0x3e, 0x9b, 0x88, 0x10, 0xd8, 0xee, 0x37, 0xce, 0x29, 0x38, 0x1b, 0x99, 0x8b, 0x69, 0x0a,
+  0xc9, 0x49, 0xc0, 0x88, 0x48, 0x09, 0xce, 0x22, 0x13, 0x96, 0x32, 0xdb, 0xb6, 0x21, 0xcb, 0x69,
+  0x17, 0x28, 0xb6, 0xd2, 0x45, 0x8a, 0x1d, 0xab, 0x24, 0x50, 0xed, 0x0c, 0x44, 0xc4, 0x7e, 0xc8,
+  0xfd, 0x6b, 0x10, 0x0d, 0x60, 0xca, 0x2f, 0xa5, 0x38, 0x4c, 0xab, 0x31, 0xb8, 0xc4, 0xec, 0x0a,
+  0xbe, 0xc3, 0xe8, 0x98, 0xe5, 0xbd, 0xb6, 0x9a, 0xbe, 0x0a, 0xad, 0x57, 0x90, 0xdb, 0x4b, 0xa3,
+  0xc4, 0x45, 0x93, 0x24, 0x9c, 0x43, 0xf4, 0x1a, 0x71, 0x89, 0xeb, 0x3b, 0x7c, 0x25, 0x60, 0xbf,
+  0x39, 0x20, 0xcf, 0x1e, 0x89, 0x0b, 0x56, 0xbf, 0xc8, 0x69, 0x3e, 0xcd, 0x10, 0x93, 0x7a, 0x7a,
+  0x24, 0x86, 0x0c, 0xac, 0xb4, 0x64, 0xec, 0xe2, 0xf2, 0xfd, 0xf9, 0x6e, 0x08, 0x50, 0x2f, 0xe8,
+  0xf0, 0x09, 0x9d, 0x66, 0xac, 0x82, 0x2f, 0x17, 0xe3, 0x71, 0xc8, 0xce, 0x71, 0x14, 0x11, 0x9e,
+  0xc3, 0x94, 0xb6, 0x7c, 0x7b, 0x2c, 0x5d, 0xf4, 0x86, 0x9d, 0x4b, 0xbf, 0x96, 0x74, 0x51, 0x65,
+  0x6c, 0xd9, 0xaa, 0xb4, 0x77, 0x32, 0xb7, 0xca, 0xb8, 0x36, 0x58, 0x4d, 0xbf, 0x7e, 0x19, 0x90,
+  0x1e, 0x04, 0x8b, 0xb8, 0x3a, 0x86, 0xb6, 0x89, 0x46, 0x84, 0xe3, 0x03, 0xf5, 0xb5, 0xf0, 0x47,
+  0x19, 0x16, 0x14, 0x02, 0xfd, 0xbc, 0x9c, 0x77, 0xcf, 0xb3, 0xa4, 0xdf, 0xa3, 0xb3, 0x96, 0xa1,
+  0xbd, 0x12, 0x1c, 0x20, 0xca, 0x34, 0x4a, 0xc2, 0x54, 0xe8, 0x06, 0x64, 0x08, 0xa8, 0x48, 0x51,
+  0x43, 0x2f, 0xa9, 0x5c, 0x02, 0x71, 0x6f, 0xf1, 0x5d, 0x09, 0x86, 0x8e, 0xd9, 0x28, 0x56, 0xae,
+  0x87, 0xa2, 0xc6, 0x00, 0xec, 0x2e, 0x86, 0xa4, 0x04, 0xd4, 0xfd, 0xc7, 0xef, 0xff, 0xb3, 0xab,
+  0xdb, 0xae, 0x09, 0x12, 0xe7, 0x4a, 0x4c, 0x9e, 0x72, 0xc1, 0x21, 0x4c, 0x83, 0x94, 0x99, 0xcc,
+  0x78, 0x18, 0x12, 0xb5, 0x31, 0x32, 0x92, 0x4f, 0x98, 0xf2, 0x49, 0xd8, 0x6b, 0x01, 0x66, 0x8e,
+  0xae, 0x3e, 0xc6, 0xa0, 0x21, 0x25, 0x0d, 0xae, 0x2d, 0x46, 0x64, 0x02, 0xde, 0x87, 0xf3, 0x20,
+  0x56, 0x29, 0x60, 0x59, 0xb7, 0x4c, 0x33, 0x0c, 0x3b, 0x38, 0xee, 0x83, 0x55, 0xb0, 0x78, 0xe9,
+  0x1d, 0x36, 0xb9, 0x84, 0x41, 0x55, 0x7e, 0x90, 0x88, 0xce, 0x61, 0x97, 0x1b, 0x8d, 0x60, 0xdd,
+  0x2c, 0x44, 0xf9, 0xc2, 0x12, 0xc1, 0x94, 0xe1, 0x32, 0x18, 0xf4, 0x30, 0x21, 0x8e, 0xfd, 0xb9,
+  0xbd, 0x22, 0xb8, 0x92, 0xd1, 0x87, 0x82, 0xec, 0xa4, 0x33, 0x78, 0xc9, 0x26, 0xf4, 0x86, 0x8b,
+  0x14, 0xe2, 0x75, 0x67, 0xb7, 0x58, 0xf6, 0xcb, 0xf9, 0x5b, 0x62, 0xba, 0xce, 0x1f, 0xbf, 0xff,
+  0xd7, 0xa1, 0xe3, 0x58, 0xab, 0xd1, 0x4c, 0x26, 0x87, 0x52, 0x39, 0xb3, 0x24, 0x6a, 0x48, 0x26,
+  0xfb, 0x0d, 0x95, 0x26, 0x36, 0x08, 0x84, 0xd4, 0x7e, 0xc3, 0x75, 0xe0, 0x81, 0xde, 0xf6, 0x1b,
+  0x00, 0xde, 0x20, 0x37, 0x34, 0x9c, 0x32, 0x1c, 0x84, 0xe7, 0xf6, 0xa3, 0xe3, 0xea, 0x45, 0x9e,
+  0x72, 0x3f, 0x27, 0x40, 0xd2, 0x2a, 0x1d, 0x2a, 0x23, 0x95, 0x84, 0x64, 0x72, 0x12, 0xe8, 0x56,
+  0x24, 0x98, 0xc4, 0x14, 0x4b, 0x3a, 0x8d, 0xc1, 0xfb, 0xd1, 0xa8, 0xd7, 0x56, 0xa3, 0xab, 0x5f,
+  0x5d, 0xf8, 0x1a, 0x97, 0x1f, 0xdb, 0x0a, 0xdf, 0xa3, 0x09, 0xfc, 0x27, 0xcf, 0x61, 0x23, 0x25,
+  0xe6, 0xd3, 0x0d, 0x82, 0xba, 0x92, 0x73, 0xd6, 0xca, 0xea, 0xb9, 0x16, 0xd5, 0xb3, 0xe7, 0xa5,
+  0xa4, 0x3a, 0x7f, 0x46, 0x50, 0x6f, 0xe9, 0x2d, 0xe2, 0x17, 0xaa, 0x0c, 0x06, 0xfd, 0x81, 0xfa,
+  0x8e, 0x36, 0xd0, 0x84, 0x73, 0x01, 0x66, 0xbd, 0x02, 0x35, 0x51, 0x47, 0x25, 0x4d, 0x7f, 0x8a,
+  0x24, 0xd8, 0x79, 0xe9, 0x35, 0x1a, 0x3e, 0x8d, 0xc1, 0xc6, 0x13, 0x10, 0x13, 0x12, 0xb7, 0x59,
+  0x56, 0x91, 0x02, 0x5a, 0x4b, 0x57, 0x61, 0x57, 0x6e, 0xc5, 0xae, 0x0e, 0xff, 0x0c, 0x65, 0x67,
+  0x31, 0x1d, 0x86, 0x4c, 0xca, 0x2b, 0xdb, 0x60, 0x57, 0xf2, 0x7b, 0x63, 0x8d, 0xe1, 0xfc, 0xca,
+  0xb2, 0x87, 0xcc, 0x0a, 0x8c, 0xee, 0x9d, 0xf8, 0x7a, 0xb3, 0xfa, 0x11, 0x82, 0x40, 0x2b, 0x9f,
+  0x40, 0x06, 0x38, 0x9e, 0xa0, 0x68, 0x12, 0x99, 0x23, 0x98, 0xb1, 0x20, 0x93, 0x69, 0x04, 0x51,
+  0xe9, 0x37, 0x99, 0xae, 0x37, 0xc9, 0x11, 0x81, 0xa4, 0x3c, 0x93, 0xb2, 0x4d, 0x19, 0x36, 0x38,
+  0xac, 0x4d, 0xfc, 0x4c, 0xd3, 0xa1, 0xf8, 0xf7, 0xb8, 0xc9, 0x3b, 0x36, 0xc3, 0x54, 0x9d, 0x80,
+  0x29, 0x04, 0xf0, 0x30, 0xde, 0x40, 0x65, 0x1c, 0xae, 0x23, 0xf1, 0x27, 0xc6, 0x12, 0x72, 0x86,
+  0xd9, 0xeb, 0xc3, 0x94, 0x12, 0x85, 0x85, 0x05, 0x90, 0xf7, 0xc9, 0x0c, 0x0b, 0xe2, 0x70, 0x3e,
+  0x21, 0xb2, 0xa0, 0x7a, 0x08, 0xaa, 0x83, 0x49, 0x62, 0x04, 0xe5, 0xc7, 0x5f, 0xa0, 0x33, 0xd8,
+  0xf5, 0x51, 0x1d, 0x43, 0x01, 0x11, 0x18, 0x62, 0x36, 0x6c, 0x27, 0xf9, 0x06, 0x3e, 0xd5, 0x84,
+  0x75, 0xbc, 0x7e, 0xb8, 0xd8, 0xa0, 0x8d, 0x0f, 0x3f, 0x6d, 0x60, 0xe5, 0xc3, 0x05, 0xf9, 0xfe,
+  0x46, 0xa4, 0xf4, 0xfa, 0xeb, 0xb9, 0xb9, 0x94, 0xf9, 0x31, 0x89, 0x20, 0x23, 0x0d, 0x37, 0x70,
+  0x11, 0x70, 0xa8, 0xbd, 0x92, 0xc9, 0x3a, 0x36, 0x7e, 0x80, 0x6d, 0x8b, 0x98, 0x60, 0x9a, 0x2d,
+  0x74, 0x7b, 0x6b, 0x03, 0x4f, 0xdf, 0x2b, 0x24, 0x6a, 0xf2, 0x10, 0x5f, 0xa2, 0x62, 0xcf, 0xb3,
+  0x76, 0xe1, 0x64, 0x92, 0x16, 0x39, 0x82, 0x2e, 0x7d, 0x74, 0x27, 0x41, 0x35, 0x78, 0xca, 0x08,
+  0x31, 0x39, 0x1c, 0xa8, 0x3c, 0x0c, 0xdc, 0x17, 0x9e, 0x1f, 0x97, 0x40, 0x97, 0x59, 0x17, 0x20,
+  0x58, 0xcd, 0x81, 0x75, 0x7a, 0xe7, 0x42, 0x7e, 0xf7, 0x23, 0x3a, 0x28, 0x69, 0x91, 0x0b, 0x28,
+  0x67, 0xb7, 0x24, 0x8a, 0x1b, 0x71, 0x75, 0x2a, 0xb8, 0x7e, 0x00, 0xf7, 0xff, 0x1a, 0x5c, 0x87,
+  0x80, 0xeb, 0xa5, 0xc8, 0x11, 0x13, 0xc8, 0xf5, 0x6b, 0x30, 0x3d, 0xab, 0x50, 0xa5, 0xd5, 0xb6,
+  0x21, 0x8b, 0x05, 0x21, 0x7f, 0xaf, 0x32, 0x9c, 0xa2, 0xf0, 0x7a, 0x8c, 0xe0, 0x2b, 0x66, 0x86,
+  0xe0, 0xcb, 0x44, 0x50, 0x55, 0xec, 0xd8, 0x88, 0x6c, 0xac, 0x58, 0xc5, 0xd6, 0x54, 0x3c, 0x14,
+  0x34, 0x38, 0x57, 0xa4, 0x60, 0x2e, 0xfe, 0x06, 0x5e, 0x1f, 0x99, 0xcc, 0x83, 0x3b, 0xb0, 0x9c,
+  0x55, 0x70, 0x7c, 0x2f, 0x07, 0xb6, 0xa4, 0xf2, 0xc8, 0xc3, 0x28, 0x64, 0x28, 0x56, 0xcd, 0x44,
+  0xd1, 0x64, 0xc0, 0x0e, 0x60, 0xc9, 0x32, 0x08, 0xe7, 0x07, 0x9c, 0x56, 0x8a, 0x69, 0x07, 0x41,
+  0x6d, 0xa5, 0x59, 0xae, 0x8c, 0x85, 0x9e, 0x69, 0x40, 0xf6, 0x6a, 0x54, 0xaa, 0x3e, 0x78, 0x5d,
+  0xe5, 0xff, 0x31, 0xd8, 0x62, 0xc8, 0x89, 0xab, 0xe8, 0xf0, 0x1d, 0x78, 0x0d, 0xd9, 0x9f, 0x43,
+  0xfa, 0x2a, 0x0a, 0x4c, 0xc3, 0x97, 0xe5, 0x24, 0x62, 0x3d, 0x9f, 0x66, 0x93, 0x07, 0xab, 0xc9,
+  0x47, 0x60, 0xc4, 0xba, 0xd0, 0x90, 0x45, 0xa5, 0x48, 0xd6, 0x71, 0xbc, 0x4b, 0x25, 0x22, 0xb1,
+  0xbd, 0x81, 0xe4, 0xa4, 0x31, 0xd8, 0xad, 0xd4, 0x20, 0xaa, 0xc5, 0x82, 0xe5, 0x85, 0x20, 0x39,
+  0x4f, 0x3c, 0x28, 0x05, 0x18, 0x69, 0x94, 0x5e, 0xd8, 0x90, 0x45, 0x04, 0x8b, 0x59, 0x8a, 0x15,
+  0x46, 0x00, 0x36, 0x04, 0xb5, 0x0c, 0xa6, 0x25, 0x19, 0x1f, 0xc7, 0x50, 0xfd, 0x82, 0xbf, 0x01,
+  0x0e, 0xec, 0x05, 0x64, 0x28, 0x00, 0x3d, 0x43, 0xa4, 0x50, 0x39, 0x7c, 0xc8, 0x54, 0x49, 0xa2,
+  0x1c, 0x51, 0xf9, 0xab, 0x9a, 0x1c, 0x89, 0x94, 0x41, 0x26, 0x80, 0x5d, 0x8f, 0xc8, 0x5e, 0x2d,
+  0x14, 0x0a, 0x6a, 0x7b, 0x99, 0x9f, 0xf2, 0x04, 0x5c, 0x06, 0x0c, 0x57, 0x37, 0x46, 0x7e, 0x11,
+  0xe9, 0x35, 0xe4, 0x10, 0x7d, 0x12, 0x4f, 0xc3, 0xb0, 0xbb, 0xb7, 0x47, 0xb3, 0x79, 0xec, 0x93,
+  0xd1, 0x34, 0xf6, 0x65, 0xa8, 0xae, 0xd5, 0xf9, 0x0b, 0xc0, 0x08, 0x4a, 0x82, 0xcd, 0x2e, 0x41,
+  0x00, 0x36, 0x23, 0x1f, 0x7e, 0x7e, 0x73, 0xc1, 0x68, 0xea, 0x4f, 0xce, 0x29, 0x84, 0xee, 0xcc,
+  0x5c, 0x48, 0x81, 0x40, 0x7d, 0xe0, 0x91, 0x40, 0xf8, 0xd3, 0x88, 0xc5, 0xb9, 0x0d, 0xe5, 0xfd,
+  0x59, 0xc8, 0xf0, 0xf1, 0xe5, 0xfc, 0x35, 0x28, 0x05, 0xbe, 0x1a, 0x96, 0x2d, 0xf7, 0x80, 0xa6,
+  0x9c, 0xae, 0xb2, 0xf8, 0x0d, 0x10, 0x6a, 0x42, 0x1d, 0x48, 0xa5, 0xd6, 0x1b, 0x80, 0xd4, 0x84,
+  0x3a, 0x90, 0xcc, 0xeb, 0x36, 0xc0, 0xc8, 0xef, 0xf7, 0x41, 0x20, 0x5d, 0xde, 0x02, 0x04, 0x33,
+  0xea, 0x60, 0x3a, 0x9b, 0xdd, 0x00, 0xa6, 0x67, 0xd4, 0xc1, 0xe2, 0x70, 0x03, 0x44, 0x1c, 0xd6,
+  0x27, 0xab, 0x3c, 0x62, 0x03, 0x80, 0x9a, 0x50, 0x07, 0xd2, 0xdb, 0xf6, 0x06, 0x28, 0x3d, 0x63,
+  0x45, 0x0c, 0x98, 0x41, 0x6e, 0x12, 0x02, 0x7e, 0x2f, 0x40, 0x00, 0xe2, 0xce, 0xea, 0x2e, 0x8d,
+  0x05, 0xad, 0x8b, 0xce, 0x28, 0xcf, 0xc9, 0x88, 0xe5, 0xfe, 0xc4, 0x34, 0xda, 0xca, 0xd3, 0x4f,
+  0x0d, 0x72, 0x40, 0x12, 0x3b, 0x17, 0x58, 0xeb, 0x61, 0xeb, 0xa6, 0x02, 0x93, 0x2f, 0x61, 0x52,
+  0x1b, 0xeb, 0x6f, 0x73, 0xf9, 0x4d, 0x84, 0xcc, 0x0e, 0xc5, 0xd8, 0xcc, 0xe5, 0x48, 0xa5, 0x77,
+  0xd4, 0xdd, 0xbb, 0xbb, 0x67, 0xbe, 0xb5, 0x96, 0x17, 0x1a, 0xa7, 0xc2, 0x59, 0xb3, 0xea, 0x72,
+  0xd1, 0x80, 0xe6, 0x14, 0xd6, 0x7d, 0x98, 0x49, 0x19, 0xf4, 0x14, 0x8f, 0x08, 0xc5, 0x47, 0xe6,
+  0x3f, 0x24, 0xcc, 0x97, 0x2f, 0x12, 0xd6, 0x06, 0x3e, 0x22, 0xd3, 0xea, 0xf7, 0xfb, 0x86, 0x61,
+  0x2d, 0x20, 0xe0, 0xb0, 0x34, 0x37, 0x8d, 0x77, 0x22, 0x9f, 0xc8, 0x56, 0x80, 0x80, 0x90, 0x16,
+  0x07, 0x86, 0xd5, 0x05, 0x3f, 0x05, 0x79, 0xc5, 0x5d, 0x72, 0x07, 0x48, 0xda, 0x6d, 0x45, 0xa5,
+  0xea, 0x30, 0x14, 0xcd, 0x48, 0xb2, 0xec, 0xcc, 0xef, 0x11, 0xf5, 0x5d, 0x37, 0x2b, 0x4c, 0x5c,
+  0x48, 0xd2, 0x8c, 0x80, 0x80, 0x0f, 0xf1, 0xaa, 0x66, 0x02, 0x8c, 0xe5, 0xe9, 0x5c, 0xb9, 0xe0,
+  0x43, 0x92, 0xc7, 0xe2, 0xca, 0x68, 0x92, 0x45, 0xc4, 0xf2, 0x89, 0x08, 0x3c, 0xe3, 0xfc, 0xfd,
+  0xc5, 0x25, 0xbc, 0xab, 0x46, 0x6c, 0xe6, 0x2d, 0x8c, 0x57, 0xea, 0x94, 0xb4, 0x85, 0x81, 0xdd,
+  0xf0, 0x24, 0xcb, 0x6d, 0xd8, 0xae, 0x78, 0x6c, 0xdc, 0x35, 0x09, 0xb6, 0x7c, 0x3d, 0x24, 0x40,
+  0xa9, 0x77, 0xb3, 0xb2, 0xd6, 0xa9, 0xeb, 0xce, 0xa7, 0x48, 0x07, 0x03, 0xe9, 0x14, 0x1f, 0x59,
+  0x9a, 0x8a, 0x14, 0x46, 0x50, 0x1a, 0xeb, 0x14, 0x58, 0x76, 0xf6, 0x16, 0x9a, 0xc1, 0x07, 0x99,
+  0x53, 0xe1, 0xbe, 0xfb, 0x30, 0x55, 0xab, 0x14, 0x3d, 0x9e, 0x9e, 0x5a, 0x67, 0x70, 0x2b, 0x41,
+  0xb2, 0xaf, 0xf8, 0x37, 0x53, 0x54, 0xf1, 0x80, 0xc5, 0x2e, 0x16, 0x90, 0xc9, 0xc9, 0x46, 0x4d,
+  0x81, 0x57, 0x15, 0xc2, 0xae, 0x32, 0x11, 0xaf, 0x53, 0xe0, 0x95, 0x1e, 0xdb, 0x25, 0xae, 0xf7,
+  0xaf, 0x6c, 0x78, 0xdb, 0x32, 0xbf, 0x1e, 0xd5, 0x81, 0x82, 0x2b, 0x5b, 0x0d, 0x9d, 0xba, 0x9e,
+  0xb3, 0x05, 0xb6, 0x1e, 0xdc, 0x61, 0x39, 0x35, 0xb0, 0x05, 0xaa, 0x16, 0xde, 0x01, 0x48, 0xbe,
+  0xef, 0xb0, 0xda, 0x4a, 0x84, 0xd7, 0x90, 0x30, 0x72, 0xba, 0x7c, 0xf2, 0xdc, 0x2d, 0x38, 0x56,
+  0xc2, 0x3d, 0xe0, 0xd0, 0x23, 0xa7, 0xcb, 0x27, 0xef, 0x70, 0x0b, 0x8e, 0x72, 0x03, 0x00, 0xf0,
+  0x38, 0xdc, 0x32, 0xbb, 0x1e, 0xfd, 0x01, 0x42, 0x0d, 0x6c, 0x81, 0x5a, 0x89, 0xfe, 0x52, 0x2d,
+  0x7a, 0x6c, 0x17, 0x49, 0x55, 0xb7, 0x01, 0x09, 0x2b, 0x47, 0x0a, 0xc8, 0xed, 0xc6, 0x5d, 0x4f,
+  0x3c, 0x74, 0xe9, 0xc1, 0x03, 0x69, 0xda, 0x10, 0x6e, 0x21, 0x21, 0xeb, 0xbb, 0x00, 0xbd, 0x93,
+  0x11, 0x1e, 0x3b, 0xdd, 0x9d, 0x2d, 0xc8, 0x3d, 0xe9, 0xee, 0xae, 0x7f, 0xb7, 0xbb, 0xbb, 0x9e,
+  0x8f, 0xba, 0xbb, 0xda, 0xa3, 0xab, 0xf6, 0x03, 0xcd, 0x65, 0x67, 0x57, 0x2e, 0xdd, 0xce, 0x63,
+  0xd8, 0x74, 0xfe, 0x26, 0x36, 0x3b, 0x7f, 0x92, 0xcd, 0xc3, 0x9d, 0xd9, 0x74, 0x1f, 0xc1, 0x66,
+  0xe7, 0x6f, 0xe2, 0xd2, 0xd9, 0x99, 0xcb, 0x4d, 0x33, 0x57, 0x5c, 0x0c, 0xe7, 0x56, 0x24, 0xf2,
+  0x6c, 0x57, 0x89, 0xbc, 0x78, 0x8c, 0xde, 0xff, 0x2e, 0x89, 0x1c, 0x3e, 0x46, 0xef, 0x3b, 0x4b,
+  0x44, 0xdb, 0xc8, 0x4a, 0x9a, 0x06, 0xe1, 0x01, 0x72, 0x9e, 0x37, 0xd5, 0x34, 0xc9, 0x23, 0x2c,
+  0x9a, 0x86, 0xcb, 0x83, 0x1a, 0x75, 0xd4, 0x5b, 0x1c, 0xd5, 0xa8, 0x13, 0x98, 0x8c, 0x47, 0x3c,
+  0xa4, 0x29, 0x49, 0xa7, 0x21, 0xcb, 0x64, 0xe1, 0x53, 0x9c, 0x8e, 0xf1, 0xa8, 0x52, 0xf8, 0xd4,
+  0x53, 0xc6, 0x22, 0xd9, 0xc2, 0x5d, 0x5a, 0x95, 0x3d, 0x21, 0x94, 0x39, 0xf2, 0xae, 0x15, 0x50,
+  0x68, 0x56, 0x31, 0x54, 0xf2, 0x47, 0x3d, 0x7c, 0x16, 0x6e, 0x4a, 0x22, 0x2b, 0x67, 0x73, 0x46,
+  0x0d, 0x56, 0xdf, 0x7a, 0xd8, 0x08, 0xba, 0x3c, 0x4b, 0x53, 0xa0, 0xcb, 0x05, 0x65, 0x3a, 0xa1,
+  0x53, 0x37, 0xc0, 0x60, 0x18, 0xea, 0xab, 0x9a, 0x6e, 0xcb, 0xc6, 0x83, 0x2d, 0x9b, 0x27, 0xf8,
+  0xd1, 0x79, 0x6a, 0x94, 0xeb, 0x82, 0x45, 0xc1, 0x58, 0x82, 0x37, 0xe8, 0x80, 0x3d, 0x73, 0x17,
+  0xcb, 0xfb, 0xf2, 0xc5, 0x75, 0x9c, 0x0a, 0xe9, 0xca, 0xd6, 0x76, 0xc2, 0x52, 0x37, 0x4b, 0x40,
+  0xd4, 0xb1, 0xda, 0x80, 0xcc, 0x76, 0x4a, 0x6c, 0xda, 0xc2, 0x76, 0x42, 0xb7, 0x62, 0x8d, 0x5f,
+  0xbe, 0x1c, 0x56, 0x4b, 0x08, 0x65, 0xd6, 0x3b, 0x21, 0x5a, 0x71, 0x01, 0x20, 0x0c, 0x10, 0xe9,
+  0x1c, 0x9b, 0x47, 0x09, 0xd4, 0xe6, 0x90, 0x02, 0xb5, 0xd4, 0x9d, 0xa1, 0x16, 0xc7, 0xe6, 0x04,
+  0x85, 0x51, 0x34, 0x2f, 0x1e, 0x93, 0x7f, 0x5e, 0xc8, 0x0a, 0x5c, 0x2b, 0x03, 0xa0, 0x4a, 0x5b,
+  0xc2, 0x59, 0xec, 0xf5, 0x4f, 0xaf, 0xcd, 0x88, 0xd1, 0xd8, 0x52, 0x89, 0x19, 0xe0, 0x04, 0xc3,
+  0x4e, 0xc5, 0xad, 0x3a, 0x61, 0x2c, 0x11, 0x93, 0xe1, 0x9c, 0x80, 0x35, 0xe7, 0x1c, 0xac, 0x5e,
+  0x76, 0x60, 0x01, 0x46, 0x35, 0xb2, 0xd9, 0x6d, 0x62, 0xaa, 0x39, 0xfb, 0xf2, 0x86, 0xa2, 0x55,
+  0xc9, 0xdd, 0xc6, 0x90, 0x63, 0xa2, 0xd5, 0xbc, 0xa5, 0xf9, 0xc4, 0xce, 0x3e, 0x43, 0xc5, 0xd1,
+  0xea, 0xec, 0xcb, 0x17, 0xcc, 0xda, 0xe4, 0x43, 0x4a, 0xe3, 0x40, 0x40, 0x61, 0x62, 0x59, 0xea,
+  0x83, 0x2f, 0x32, 0x53, 0xcf, 0x39, 0x7f, 0xbd, 0x5f, 0x9f, 0x52, 0x4d, 0x0b, 0x33, 0x3e, 0x8e,
+  0xb0, 0x20, 0x72, 0xec, 0xe3, 0xea, 0xf0, 0x88, 0x62, 0x37, 0xa2, 0x58, 0x12, 0x69, 0x93, 0x13,
+  0xf7, 0x25, 0x25, 0x1a, 0x81, 0xaa, 0x70, 0xd4, 0x8c, 0x88, 0xde, 0x9a, 0x47, 0x4d, 0xc5, 0xce,
+  0x7e, 0x01, 0xbd, 0x4f, 0x4c, 0x17, 0xca, 0xbf, 0x3a, 0x81, 0xfb, 0x9d, 0x96, 0x6b, 0xed, 0x2b,
+  0x23, 0x51, 0xa4, 0xdc, 0xed, 0x95, 0x86, 0x01, 0xf0, 0x6f, 0x91, 0xd3, 0x23, 0x07, 0xfe, 0x91,
+  0x36, 0x31, 0xd1, 0x76, 0xf7, 0xc9, 0x73, 0x39, 0x11, 0x1d, 0x9b, 0xf7, 0x9d, 0xe2, 0x51, 0x37,
+  0xd9, 0x58, 0xa0, 0xbd, 0xa1, 0xa6, 0x95, 0x9c, 0x25, 0xa6, 0x56, 0x06, 0x06, 0xdd, 0x41, 0x1f,
+  0xbd, 0xc7, 0x0e, 0x59, 0x3c, 0xce, 0x27, 0x98, 0x9a, 0x6c, 0xf0, 0xf5, 0xb5, 0x4e, 0xd5, 0x37,
+  0xf0, 0x76, 0x92, 0x51, 0xaf, 0xeb, 0xa4, 0xa2, 0xf5, 0x09, 0x18, 0x94, 0x68, 0x11, 0xda, 0x34,
+  0x5d, 0x5a, 0xb7, 0x3f, 0x99, 0xc6, 0xd7, 0x15, 0x99, 0xfa, 0x40, 0x27, 0x52, 0xf1, 0x91, 0x7f,
+  0xea, 0x16, 0x84, 0xd5, 0x45, 0x03, 0x4b, 0x90, 0xde, 0x12, 0xfe, 0x9b, 0x6f, 0x48, 0xfb, 0x23,
+  0x6d, 0xfd, 0xf6, 0x5d, 0xeb, 0x3f, 0x9d, 0xd6, 0x8b, 0x4f, 0x6d, 0x1b, 0x9b, 0x45, 0xa6, 0x6f,
+  0x69, 0xb6, 0x0a, 0xb4, 0xc0, 0x53, 0xa1, 0xa7, 0x88, 0xc7, 0xa6, 0x36, 0xf3, 0x66, 0xa9, 0x17,
+  0x57, 0x3f, 0x8f, 0x42, 0x01, 0x69, 0x58, 0x7d, 0x45, 0x3d, 0xdb, 0x3a, 0x70, 0x0b, 0xb3, 0x50,
+  0x3c, 0xa5, 0x0c, 0xed, 0x76, 0x96, 0x0a, 0xb0, 0xd1, 0x92, 0x0f, 0x25, 0x77, 0x35, 0x5a, 0x44,
+  0x20, 0xfc, 0x07, 0xae, 0x61, 0xe2, 0x97, 0x6b, 0x50, 0xce, 0x75, 0x0f, 0x08, 0xea, 0x5e, 0x1f,
+  0x1c, 0x58, 0x7a, 0xe2, 0x41, 0x9f, 0xa8, 0xe2, 0xdf, 0x1e, 0xa5, 0x22, 0x7a, 0x35, 0xa1, 0xe9,
+  0x2b, 0x11, 0x30, 0xf3, 0xc5, 0x31, 0x98, 0xc6, 0x83, 0x74, 0x75, 0x8e, 0x4a, 0x7a, 0x4a, 0x3d,
+  0x03, 0x2a, 0x89, 0xb3, 0xf8, 0xf2, 0x50, 0x6c, 0x5c, 0x42, 0x54, 0x58, 0xc2, 0x4b, 0x57, 0xf2,
+  0xb0, 0x88, 0xd0, 0x11, 0x86, 0x32, 0x4a, 0x64, 0x03, 0x90, 0xc8, 0xfa, 0x4d, 0x4f, 0x83, 0x44,
+  0x14, 0x6d, 0x00, 0x32, 0x68, 0x13, 0x4a, 0xfc, 0xc1, 0x62, 0xd9, 0x8d, 0xac, 0x9a, 0xda, 0xf2,
+  0xd9, 0xce, 0x42, 0xa8, 0xc8, 0x4d, 0xa7, 0x49, 0x5a, 0x92, 0xaa, 0xc2, 0xba, 0xba, 0x4b, 0xb0,
+  0x9d, 0xe9, 0x93, 0x14, 0xc2, 0xf6, 0x16, 0xab, 0x7b, 0x05, 0xf2, 0x46, 0x81, 0x48, 0x53, 0x6c,
+  0x90, 0xcb, 0x23, 0xdf, 0xe5, 0xb4, 0xf5, 0x92, 0x2e, 0x09, 0xdd, 0xc0, 0xc3, 0x3d, 0x51, 0x16,
+  0xb6, 0xb8, 0x03, 0x99, 0x84, 0x1f, 0x1c, 0x74, 0x1f, 0xda, 0x6c, 0x2a, 0x4a, 0x34, 0x79, 0xbb,
+  0xea, 0x67, 0x68, 0xd0, 0xd6, 0x81, 0xf1, 0xd4, 0xe8, 0x56, 0xa8, 0xb8, 0x6b, 0x92, 0x6b, 0x70,
+  0xe9, 0x7a, 0xdc, 0x7c, 0x9b, 0x59, 0x15, 0xb9, 0xdd, 0xed, 0x2d, 0xa7, 0xde, 0x9b, 0xb6, 0xdf,
+  0xa9, 0x1a, 0x2a, 0x0d, 0x6e, 0xa4, 0xf7, 0x71, 0x0c, 0xac, 0xe8, 0x09, 0xe6, 0x10, 0xcf, 0x9a,
+  0xe3, 0x18, 0x34, 0x9c, 0xa3, 0x3b, 0x67, 0xfa, 0xae, 0x47, 0x92, 0xc8, 0x3e, 0x0a, 0x5e, 0xd3,
+  0x50, 0x22, 0xb5, 0x34, 0x12, 0x8e, 0xa2, 0x40, 0x41, 0xca, 0x8d, 0xe0, 0x9a, 0x27, 0x84, 0x62,
+  0xa7, 0x04, 0x02, 0x23, 0xe2, 0x9d, 0x31, 0x92, 0xf9, 0x13, 0x16, 0x4c, 0xc3, 0x22, 0xf5, 0xd0,
+  0x60, 0x3a, 0x0c, 0xec, 0x29, 0x72, 0xf7, 0xee, 0x09, 0xd7, 0x57, 0x9f, 0x76, 0xb4, 0x00, 0x14,
+  0xaf, 0x9e, 0xff, 0x35, 0x22, 0xbe, 0x2b, 0xf6, 0x33, 0x88, 0x7e, 0x84, 0xa2, 0x1c, 0x54, 0x80,
+  0xcb, 0xb4, 0x18, 0x03, 0x82, 0x2e, 0x28, 0xa3, 0x6c, 0x99, 0x59, 0x14, 0x39, 0x12, 0x18, 0xce,
+  0x32, 0x20, 0x22, 0x82, 0x4a, 0x04, 0x39, 0xa9, 0x45, 0x10, 0xa5, 0x88, 0x76, 0xc7, 0xb2, 0x96,
+  0x09, 0xdb, 0xca, 0x39, 0x10, 0x31, 0xdf, 0xfd, 0xc7, 0x85, 0xe5, 0x91, 0xca, 0x6d, 0x28, 0xec,
+  0xf2, 0x60, 0xd3, 0x5b, 0x9a, 0xf6, 0x34, 0xc5, 0x0b, 0x8f, 0xcb, 0xee, 0x3f, 0x6e, 0xb0, 0x38,
+  0x5e, 0x9c, 0xf0, 0x92, 0x2c, 0x14, 0xf9, 0x6a, 0x0f, 0x04, 0xaf, 0xfa, 0xe9, 0x83, 0x99, 0xf5,
+  0x6d, 0x90, 0xb2, 0xc1, 0x61, 0xae, 0x74, 0x68, 0x14, 0x94, 0x61, 0x59, 0xf7, 0x1a, 0x1f, 0xb9,
+  0xfc, 0x0b, 0x02, 0xdc, 0x70, 0x16, 0x77, 0x5d, 0xa8, 0x64, 0x0b, 0x06, 0x6c, 0xf0, 0xb3, 0x33,
+  0x0a, 0xd0, 0x09, 0xe9, 0x0f, 0xd4, 0x9c, 0x8f, 0x89, 0xcd, 0x83, 0x4f, 0x98, 0x69, 0xd8, 0xf8,
+  0x5e, 0xdf, 0x44, 0xd9, 0x96, 0x74, 0x50, 0x8c, 0x8a, 0x66, 0x0c, 0x4c, 0xb5, 0xa5, 0x79, 0xfe,
+  0x78, 0xf9, 0xf6, 0x4d, 0x25, 0x88, 0x16, 0x8e, 0xcd, 0x21, 0x31, 0xe6, 0xbd, 0xfe, 0x49, 0x97,
+  0xa3, 0x5f, 0x6b, 0xfc, 0xa2, 0x8a, 0x5d, 0xc5, 0x66, 0xbd, 0x80, 0x69, 0xa8, 0x03, 0x54, 0x6c,
+  0x40, 0x89, 0x65, 0x49, 0xce, 0xf1, 0xa5, 0x6e, 0x70, 0x60, 0xe6, 0xc4, 0x20, 0xff, 0xf7, 0xbf,
+  0x04, 0x1b, 0xb2, 0xa6, 0xe2, 0x88, 0x7f, 0xc2, 0xae, 0xa6, 0x61, 0xb2, 0x28, 0xc9, 0xe7, 0x16,
+  0xa2, 0x40, 0xea, 0x94, 0xab, 0xbc, 0x9a, 0xf0, 0x30, 0x30, 0x85, 0x55, 0x6c, 0x74, 0xb0, 0x57,
+  0x5d, 0xd9, 0xb0, 0xad, 0xf3, 0x1b, 0x66, 0xc9, 0x69, 0x65, 0xf9, 0xaf, 0x46, 0x77, 0xaa, 0xfd,
+  0x57, 0x3b, 0x7f, 0x95, 0xbb, 0x73, 0xe5, 0xc1, 0x03, 0x0f, 0xb6, 0x0b, 0xb3, 0x6c, 0xd0, 0x96,
+  0x6a, 0x44, 0xdd, 0x80, 0x79, 0x27, 0x20, 0x14, 0x6d, 0x28, 0x72, 0xd8, 0x68, 0x92, 0xe5, 0x3b,
+  0x32, 0xcf, 0x03, 0x4b, 0x37, 0x76, 0x15, 0x50, 0x5f, 0x95, 0x07, 0x56, 0xc5, 0xa5, 0x37, 0x76,
+  0x90, 0xd7, 0xb4, 0x00, 0x15, 0xf6, 0x36, 0xb2, 0x73, 0x0a, 0xf5, 0x9d, 0x5a, 0x05, 0x05, 0xfe,
+  0x8d, 0xfc, 0x03, 0x15, 0x7c, 0x67, 0x31, 0x5e, 0xff, 0xfc, 0xf0, 0xf3, 0xeb, 0x57, 0x40, 0xa1,
+  0x88, 0x51, 0x75, 0xd2, 0x8c, 0xee, 0xf5, 0xbc, 0xeb, 0xcd, 0x43, 0x95, 0xf7, 0xd4, 0x4c, 0xbf,
+  0x7b, 0x5f, 0x8e, 0xb5, 0x83, 0xcf, 0xc5, 0x0e, 0x94, 0x22, 0x40, 0x41, 0xe9, 0x4e, 0x92, 0xde,
+  0x85, 0xcc, 0x95, 0x3e, 0xfd, 0x0a, 0x8d, 0x2b, 0x47, 0xab, 0xbb, 0x50, 0xa9, 0x40, 0xfe, 0x72,
+  0x3a, 0xef, 0x8b, 0x53, 0xd6, 0x9c, 0x78, 0xe3, 0x4f, 0xdf, 0xd8, 0x53, 0xfd, 0x53, 0x92, 0x4c,
+  0xe5, 0x2d, 0x6c, 0xbc, 0xbe, 0x4e, 0xda, 0xec, 0x06, 0x16, 0xcc, 0xba, 0x84, 0x41, 0x58, 0x80,
+  0x08, 0x9a, 0x65, 0x74, 0x0c, 0x91, 0x8c, 0xa6, 0x29, 0x87, 0xf8, 0x21, 0x62, 0xbc, 0x36, 0x08,
+  0x21, 0x6c, 0xc4, 0x59, 0x18, 0x60, 0x94, 0xa3, 0x72, 0xe7, 0x8e, 0xc7, 0x2c, 0xd8, 0xd3, 0x69,
+  0x1a, 0xe2, 0x87, 0x38, 0x93, 0x7b, 0x4e, 0x33, 0x83, 0x9f, 0x19, 0xfc, 0x30, 0xf8, 0x89, 0xe1,
+  0x67, 0x08, 0x3f, 0x9f, 0x3d, 0xe7, 0x6e, 0xb5, 0x44, 0x45, 0x9a, 0xaa, 0xa2, 0x92, 0x91, 0x0a,
+  0xcf, 0xe4, 0xce, 0x90, 0x98, 0x0b, 0x31, 0x4d, 0x21, 0xff, 0x30, 0x34, 0x69, 0x2a, 0xc2, 0x40,
+  0xec, 0x12, 0x71, 0x41, 0x5e, 0x9f, 0xb0, 0x1b, 0x0c, 0x60, 0x2a, 0x4c, 0xbe, 0x1f, 0x5e, 0x41,
+  0x78, 0xb5, 0x69, 0x86, 0x67, 0x90, 0x26, 0xd2, 0xd3, 0x84, 0xba, 0xe6, 0xfd, 0x3b, 0x5b, 0xd6,
+  0x4e, 0x26, 0xbb, 0xb1, 0xe5, 0xb9, 0x43, 0x3d, 0xb2, 0x61, 0xec, 0xf8, 0x68, 0xfc, 0x0c, 0x3b,
+  0xe2, 0xdc, 0x68, 0x1a, 0xaa, 0x4d, 0x0f, 0x0f, 0xb2, 0x3b, 0x1e, 0x18, 0x9f, 0x3e, 0x22, 0x1a,
+  0x3b, 0x53, 0x81, 0xc4, 0xd8, 0xd6, 0xad, 0x84, 0xb9, 0xa0, 0xa8, 0x7a, 0x60, 0x92, 0x84, 0xd8,
+  0xc3, 0x53, 0x03, 0xef, 0x42, 0xfa, 0xea, 0xd6, 0x27, 0x60, 0xf6, 0xe4, 0x7b, 0x2c, 0xf2, 0xca,
+  0x98, 0x55, 0x8d, 0x61, 0x40, 0x59, 0xf9, 0x56, 0x64, 0xa7, 0x88, 0x0a, 0xc7, 0x15, 0xd2, 0xf8,
+  0xd4, 0x68, 0x1b, 0x07, 0xea, 0xd1, 0x33, 0x34, 0xb8, 0xba, 0x42, 0xa7, 0x91, 0xc8, 0x6f, 0x33,
+  0x39, 0xfe, 0xcb, 0xf9, 0x5b, 0x63, 0x09, 0xc9, 0x4e, 0x25, 0xe6, 0xb3, 0xcb, 0xef, 0x88, 0x71,
+  0xa0, 0xea, 0x29, 0xc6, 0x43, 0xfd, 0x0d, 0xab, 0x59, 0xdc, 0x73, 0x33, 0x43, 0x21, 0xd5, 0x8b,
+  0xab, 0xaf, 0x9f, 0x15, 0xa4, 0x5e, 0xf6, 0xf3, 0x81, 0x41, 0x3e, 0x4f, 0xd9, 0x54, 0x32, 0xa4,
+  0x14, 0x74, 0x57, 0x18, 0x9c, 0xbc, 0x0a, 0x20, 0xaf, 0xe0, 0x60, 0xd2, 0xc2, 0xc3, 0x5c, 0xd5,
+  0x81, 0x97, 0xbf, 0x9e, 0xbf, 0xbe, 0xb8, 0xfc, 0xd7, 0x0f, 0x6f, 0xce, 0xce, 0x2e, 0xff, 0xf5,
+  0xd3, 0xd9, 0xaf, 0xb0, 0x8d, 0xaa, 0xbd, 0x71, 0x69, 0x17, 0xf3, 0x8c, 0xa8, 0x3f, 0xa4, 0x20,
+  0x33, 0xcc, 0x18, 0xdb, 0xf2, 0xf4, 0x9a, 0xf0, 0x2c, 0x36, 0x72, 0x9c, 0x9a, 0xb2, 0x55, 0xd7,
+  0x4b, 0xd9, 0x08, 0x82, 0xec, 0x44, 0x2e, 0xb8, 0xe3, 0x09, 0x82, 0xc4, 0x59, 0xec, 0x59, 0x78,
+  0x06, 0x96, 0xda, 0xe2, 0xda, 0xaa, 0x65, 0x3d, 0x9b, 0x8f, 0x15, 0x1e, 0x34, 0x02, 0x8d, 0x59,
+  0x27, 0x38, 0x3a, 0x0f, 0xaa, 0x6c, 0x84, 0x9b, 0x01, 0xf1, 0x90, 0x1e, 0x80, 0xab, 0x3b, 0xe8,
+  0x95, 0x3d, 0x93, 0xe7, 0xdb, 0x99, 0x4e, 0x89, 0xc8, 0x69, 0x65, 0x28, 0xa2, 0x89, 0x39, 0x03,
+  0x17, 0xd0, 0x3a, 0x9a, 0xc1, 0x80, 0x5f, 0xdb, 0x09, 0x67, 0xf6, 0x30, 0x64, 0xd2, 0xf8, 0x40,
+  0x43, 0xb1, 0xbc, 0x91, 0x5b, 0xb7, 0x33, 0x98, 0x21, 0x4b, 0x84, 0xe0, 0xb4, 0x30, 0x7a, 0x6f,
+  0x66, 0xab, 0x54, 0xf0, 0x54, 0xfb, 0x03, 0x68, 0x5b, 0x0e, 0xb1, 0xe0, 0x00, 0x66, 0x4b, 0x03,
+  0x93, 0x96, 0xa7, 0x9f, 0x51, 0xf3, 0x60, 0x07, 0xdf, 0xca, 0x69, 0x11, 0x14, 0xb4, 0x07, 0xca,
+  0xda, 0x3c, 0xe3, 0x75, 0x80, 0x69, 0x49, 0x69, 0x41, 0x33, 0x5b, 0x19, 0x4b, 0x61, 0x43, 0xc5,
+  0x7b, 0xdd, 0x8a, 0x20, 0x8d, 0x11, 0x50, 0xe8, 0x19, 0xbd, 0x61, 0x3a, 0x50, 0xb4, 0xca, 0x27,
+  0x78, 0xb8, 0xd2, 0x84, 0x49, 0xfa, 0xf5, 0xa3, 0x66, 0xe3, 0x4a, 0xae, 0x5c, 0x58, 0x3a, 0x54,
+  0xab, 0x39, 0x0d, 0x0d, 0xe2, 0x11, 0xe3, 0x9d, 0x20, 0x5a, 0x58, 0x98, 0x86, 0xa5, 0x18, 0xb2,
+  0x8c, 0x22, 0x55, 0x59, 0x56, 0x12, 0x55, 0x0b, 0x6a, 0x92, 0x8e, 0xa3, 0x7b, 0x43, 0xe5, 0x7e,
+  0xbf, 0x66, 0x73, 0x2f, 0x6f, 0x92, 0xe4, 0x62, 0xd3, 0xb9, 0xac, 0x36, 0xbc, 0x7b, 0x57, 0x44,
+  0xfe, 0xcd, 0x67, 0xb6, 0x1b, 0x3d, 0x43, 0x9e, 0xb1, 0x9e, 0xe6, 0x42, 0x6e, 0x4c, 0xb9, 0xf8,
+  0xab, 0x0e, 0x5b, 0xb7, 0x6c, 0x5c, 0x75, 0x3f, 0xee, 0x3e, 0x20, 0x72, 0x14, 0xa2, 0xbf, 0x71,
+  0x7f, 0x55, 0x2c, 0x20, 0xe9, 0xfe, 0xf6, 0x65, 0x21, 0x58, 0x55, 0x36, 0x76, 0x1b, 0x8b, 0x54,
+  0xb3, 0xba, 0x83, 0xea, 0xa1, 0xe5, 0x7e, 0xa5, 0xdf, 0xab, 0xb4, 0x02, 0x96, 0x5e, 0xbb, 0xb8,
+  0x96, 0xd2, 0x6b, 0xcb, 0x3f, 0x2a, 0xea, 0xb5, 0xd5, 0x1f, 0xfd, 0xfe, 0x3f, 0x02, 0x87, 0x0a,
+  0x9d, 0x06, 0x3c, 0x00, 0x00
+};